@@ -0,0 +1,114 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CameraRigComponent.h"
+#include "Camera/CameraComponent.h"
+#include "GameFramework/SpringArmComponent.h"
+
+namespace CameraRig
+{
+    // En dessous de ces écarts, le rig est considéré arrivé
+    constexpr float LengthTolerance = 0.5f;
+    constexpr float FOVTolerance = 0.05f;
+    constexpr float SideTolerance = 0.001f;
+}
+
+UCameraRigComponent::UCameraRigComponent()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
+    // Avant le bras, qui lit TargetArmLength et SocketOffset pendant son propre tick
+    PrimaryComponentTick.TickGroup = TG_PrePhysics;
+}
+
+void UCameraRigComponent::SetRig(USpringArmComponent* InBoom, UCameraComponent* InCamera)
+{
+    Boom = InBoom;
+    Camera = InCamera;
+}
+
+void UCameraRigComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (Boom)
+    {
+        Boom->AddTickPrerequisiteComponent(this);
+    }
+
+    // Pas d'interpolation au spawn : le rig démarre directement sur sa cible
+    Current = GetTargetState();
+    Apply(Current);
+}
+
+void UCameraRigComponent::SetAiming(bool bNewAiming)
+{
+    if (bAiming != bNewAiming)
+    {
+        bAiming = bNewAiming;
+        Wake();
+    }
+}
+
+void UCameraRigComponent::SetRightShoulder(bool bNewRightShoulder)
+{
+    if (bRightShoulder != bNewRightShoulder)
+    {
+        bRightShoulder = bNewRightShoulder;
+        Wake();
+    }
+}
+
+void UCameraRigComponent::Wake()
+{
+    SetComponentTickEnabled(true);
+}
+
+UCameraRigComponent::FRigState UCameraRigComponent::GetTargetState() const
+{
+    FRigState Target;
+    Target.ArmLength = bAiming ? AimArmLength : DefaultArmLength;
+    Target.SocketOffset = bAiming ? AimSocketOffset : DefaultSocketOffset;
+    Target.FOV = bAiming ? AimFOV : DefaultFOV;
+    Target.Side = bRightShoulder ? 1.f : -1.f;
+    return Target;
+}
+
+void UCameraRigComponent::Apply(const FRigState& State)
+{
+    if (Boom)
+    {
+        Boom->TargetArmLength = State.ArmLength;
+        // Le côté d'épaule est mélangé comme le reste : la caméra passe derrière la tête au lieu de sauter
+        Boom->SocketOffset = FVector(State.SocketOffset.X, State.SocketOffset.Y * State.Side, State.SocketOffset.Z);
+    }
+    if (Camera)
+    {
+        Camera->SetFieldOfView(State.FOV);
+    }
+}
+
+void UCameraRigComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    const FRigState Target = GetTargetState();
+
+    Current.ArmLength = FMath::FInterpTo(Current.ArmLength, Target.ArmLength, DeltaTime, InterpSpeed);
+    Current.SocketOffset = FMath::VInterpTo(Current.SocketOffset, Target.SocketOffset, DeltaTime, InterpSpeed);
+    Current.FOV = FMath::FInterpTo(Current.FOV, Target.FOV, DeltaTime, InterpSpeed);
+    Current.Side = FMath::FInterpTo(Current.Side, Target.Side, DeltaTime, InterpSpeed);
+
+    const bool bArrived = FMath::IsNearlyEqual(Current.ArmLength, Target.ArmLength, CameraRig::LengthTolerance)
+        && Current.SocketOffset.Equals(Target.SocketOffset, CameraRig::LengthTolerance)
+        && FMath::IsNearlyEqual(Current.FOV, Target.FOV, CameraRig::FOVTolerance)
+        && FMath::IsNearlyEqual(Current.Side, Target.Side, CameraRig::SideTolerance);
+
+    if (bArrived)
+    {
+        // Dernière écriture exacte, puis plus aucune mise à jour tant que la cible ne change pas
+        Current = Target;
+        SetComponentTickEnabled(false);
+    }
+
+    Apply(Current);
+}
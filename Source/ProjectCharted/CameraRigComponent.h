@@ -0,0 +1,88 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "CameraRigComponent.generated.h"
+
+class USpringArmComponent;
+class UCameraComponent;
+
+/**
+ * Rig de caméra épaule : longueur du bras, décalage, FOV et côté d'épaule sont interpolés
+ * ensemble vers un seul état cible, en une passe par frame, puis écrits une fois sur le bras
+ * et l'unique caméra. Le composant s'endort dès que la cible est atteinte.
+ */
+UCLASS(ClassGroup = Camera, meta = (BlueprintSpawnableComponent))
+class UCameraRigComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UCameraRigComponent();
+
+    // Bras et caméra pilotés par le rig
+    void SetRig(USpringArmComponent* InBoom, UCameraComponent* InCamera);
+
+    // Changent l'état cible et réveillent le rig si nécessaire
+    void SetAiming(bool bNewAiming);
+    void SetRightShoulder(bool bNewRightShoulder);
+
+    bool IsAiming() const { return bAiming; }
+    bool IsRightShoulder() const { return bRightShoulder; }
+
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+protected:
+    virtual void BeginPlay() override;
+
+    UPROPERTY(EditAnywhere, Category = "Camera Rig", meta = (ClampMin = 0, Units = "cm"))
+    float DefaultArmLength = 350.f;
+
+    UPROPERTY(EditAnywhere, Category = "Camera Rig", meta = (ClampMin = 0, Units = "cm"))
+    float AimArmLength = 160.f;
+
+    // Décalage pour l'épaule droite ; l'épaule gauche utilise le miroir en Y
+    UPROPERTY(EditAnywhere, Category = "Camera Rig")
+    FVector DefaultSocketOffset = FVector(30.f, 75.f, 75.f);
+
+    UPROPERTY(EditAnywhere, Category = "Camera Rig")
+    FVector AimSocketOffset = FVector(50.f, 80.f, 80.f);
+
+    UPROPERTY(EditAnywhere, Category = "Camera Rig", meta = (ClampMin = 5, ClampMax = 170, Units = "deg"))
+    float DefaultFOV = 90.f;
+
+    UPROPERTY(EditAnywhere, Category = "Camera Rig", meta = (ClampMin = 5, ClampMax = 170, Units = "deg"))
+    float AimFOV = 60.f;
+
+    UPROPERTY(EditAnywhere, Category = "Camera Rig", meta = (ClampMin = 0))
+    float InterpSpeed = 10.f;
+
+private:
+    // État courant du rig ; Side va de -1 (épaule gauche) à 1 (épaule droite)
+    struct FRigState
+    {
+        float ArmLength = 0.f;
+        FVector SocketOffset = FVector::ZeroVector;
+        float FOV = 90.f;
+        float Side = 1.f;
+    };
+
+    FRigState GetTargetState() const;
+
+    // Écrit l'état sur le bras et la caméra
+    void Apply(const FRigState& State);
+
+    void Wake();
+
+    UPROPERTY()
+    TObjectPtr<USpringArmComponent> Boom;
+
+    UPROPERTY()
+    TObjectPtr<UCameraComponent> Camera;
+
+    FRigState Current;
+    bool bAiming = false;
+    bool bRightShoulder = true;
+};
@@ -0,0 +1,8 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CharacterDefinition.h"
+
+FPrimaryAssetId UCharacterDefinition::GetPrimaryAssetId() const
+{
+    return FPrimaryAssetId(TEXT("CharacterDefinition"), GetFName());
+}
@@ -0,0 +1,31 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "CharacterDefinition.generated.h"
+
+class USkeletalMesh;
+class UAnimInstance;
+
+/**
+ * Apparence d'un personnage pilotée par les données.
+ * Les références sont souples et rangées dans le bundle "Game" : l'état de jeu les précharge avec les armes.
+ */
+UCLASS(BlueprintType)
+class UCharacterDefinition : public UPrimaryDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    // Mesh squelette du personnage
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character", meta = (AssetBundles = "Game"))
+    TSoftObjectPtr<USkeletalMesh> Mesh;
+
+    // Blueprint d'animation compatible avec le mesh
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character", meta = (AssetBundles = "Game"))
+    TSoftClassPtr<UAnimInstance> AnimClass;
+
+    virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+};
@@ -0,0 +1,203 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "HitscanSubsystem.h"
+#include "Weapon.h"
+#include "CombatDamageable.h"
+#include "ProjectChartedCharacter.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+
+namespace HitscanSubsystem
+{
+    // Le bit de poids fort de UserData indique le tampon, le reste l'index du tir
+    constexpr uint32 BatchBit = 1u << 31;
+
+    // Décalage appliqué au point d'impact avant de poursuivre un tir pénétrant
+    constexpr float PenetrationStep = 5.f;
+}
+
+void UHitscanSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    TraceDelegate.BindUObject(this, &UHitscanSubsystem::OnTraceCompleted);
+}
+
+void UHitscanSubsystem::Deinitialize()
+{
+    TraceDelegate.Unbind();
+    Batches[0].Empty();
+    Batches[1].Empty();
+    RewindTargets.Empty();
+    Super::Deinitialize();
+}
+
+bool UHitscanSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UHitscanSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UHitscanSubsystem, STATGROUP_Tickables);
+}
+
+void UHitscanSubsystem::QueueShot(const FHitscanShot& Shot)
+{
+    Batches[WriteBatch].Add(Shot);
+}
+
+void UHitscanSubsystem::RegisterRewindTarget(AProjectChartedCharacter* Character)
+{
+    RewindTargets.AddUnique(Character);
+}
+
+void UHitscanSubsystem::UnregisterRewindTarget(AProjectChartedCharacter* Character)
+{
+    RewindTargets.RemoveSwap(Character);
+}
+
+void UHitscanSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+    FlushBatch();
+}
+
+void UHitscanSubsystem::FlushBatch()
+{
+    TArray<FHitscanShot>& Batch = Batches[WriteBatch];
+    if (Batch.Num() > 0)
+    {
+        UWorld* World = GetWorld();
+        const uint32 BatchFlag = WriteBatch ? HitscanSubsystem::BatchBit : 0u;
+
+        FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(HitscanBatch), true);
+        QueryParams.bReturnPhysicalMaterial = false;
+
+        for (int32 ShotIndex = 0; ShotIndex < Batch.Num(); ++ShotIndex)
+        {
+            const FHitscanShot& Shot = Batch[ShotIndex];
+
+            // Ignorer le tireur et son arme
+            QueryParams.ClearIgnoredActors();
+            QueryParams.AddIgnoredActor(Shot.Instigator.Get());
+            QueryParams.AddIgnoredActor(Shot.Weapon.Get());
+            QueryParams.AddIgnoredActor(Shot.PenetratedActor.Get());
+
+            // Tir rembobiné : les personnages sont testés à part, dans leur pose à l'instant vu par le tireur
+            if (Shot.RewindTime >= 0.0)
+            {
+                for (const TWeakObjectPtr<AProjectChartedCharacter>& Target : RewindTargets)
+                {
+                    QueryParams.AddIgnoredActor(Target.Get());
+                }
+            }
+
+            const FVector End = Shot.Start + Shot.Direction * Shot.Range;
+            World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Shot.Start, End, ECC_Visibility, QueryParams,
+                FCollisionResponseParams::DefaultResponseParam, &TraceDelegate, BatchFlag | uint32(ShotIndex));
+        }
+    }
+
+    // Les résultats du lot précédent ont été livrés en début de frame : on peut le réutiliser
+    WriteBatch ^= 1;
+    Batches[WriteBatch].Reset();
+}
+
+void UHitscanSubsystem::OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+    const int32 BatchIndex = (Datum.UserData & HitscanSubsystem::BatchBit) ? 1 : 0;
+    const int32 ShotIndex = int32(Datum.UserData & ~HitscanSubsystem::BatchBit);
+
+    const TArray<FHitscanShot>& Batch = Batches[BatchIndex];
+    if (!Batch.IsValidIndex(ShotIndex))
+    {
+        return;
+    }
+
+    const FHitResult* BlockingHit = Datum.OutHits.FindByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+
+    // Copie : ResolveShot peut ajouter un tir au lot en écriture
+    const FHitscanShot Shot = Batch[ShotIndex];
+
+    // Un personnage rembobiné devant le décor touché l'emporte
+    FHitResult RewoundHit;
+    if (Shot.RewindTime >= 0.0 && FindRewoundHit(Shot, BlockingHit ? BlockingHit->Distance : Shot.Range, RewoundHit))
+    {
+        ResolveShot(Shot, RewoundHit);
+    }
+    else if (BlockingHit)
+    {
+        ResolveShot(Shot, *BlockingHit);
+    }
+}
+
+bool UHitscanSubsystem::FindRewoundHit(const FHitscanShot& Shot, float MaxDistance, FHitResult& OutHit) const
+{
+    const FVector End = Shot.Start + Shot.Direction * MaxDistance;
+
+    AProjectChartedCharacter* BestCharacter = nullptr;
+    FVector BestImpactPoint = End;
+    float BestDistance = MaxDistance;
+    for (const TWeakObjectPtr<AProjectChartedCharacter>& Target : RewindTargets)
+    {
+        AProjectChartedCharacter* Character = Target.Get();
+        if (!Character || Character == Shot.Instigator.Get() || Character == Shot.PenetratedActor.Get())
+        {
+            continue;
+        }
+
+        FVector ImpactPoint;
+        if (Character->WasHitAtTime(Shot.RewindTime, Shot.Start, End, ImpactPoint))
+        {
+            const float Distance = float(FVector::Dist(Shot.Start, ImpactPoint));
+            if (Distance <= BestDistance)
+            {
+                BestCharacter = Character;
+                BestImpactPoint = ImpactPoint;
+                BestDistance = Distance;
+            }
+        }
+    }
+
+    if (!BestCharacter)
+    {
+        return false;
+    }
+
+    OutHit = FHitResult(BestCharacter, BestCharacter->GetCapsuleComponent(), BestImpactPoint, -Shot.Direction);
+    OutHit.bBlockingHit = true;
+    OutHit.TraceStart = Shot.Start;
+    OutHit.TraceEnd = End;
+    OutHit.Distance = BestDistance;
+    return true;
+}
+
+void UHitscanSubsystem::ResolveShot(const FHitscanShot& Shot, const FHitResult& Hit)
+{
+    const float Distance = Shot.DistanceTravelled + Hit.Distance;
+    const float Falloff = FWeaponStats::GetFalloffMultiplier(Distance, Shot.FalloffStart, Shot.FalloffEnd, Shot.MinDamageMultiplier);
+
+    if (ICombatDamageable* Damageable = Cast<ICombatDamageable>(Hit.GetActor()))
+    {
+        Damageable->ApplyDamage(Shot.Damage * Falloff, Shot.Weapon.Get(), Hit.ImpactPoint, Shot.Direction * Shot.Impulse);
+
+        // Confirmation au tireur
+        if (AWeapon* Weapon = Shot.Weapon.Get())
+        {
+            Weapon->OnShotHit.Broadcast(Shot.ShotId, Hit);
+        }
+    }
+
+    // Traversée : le tir continue dans le lot en cours d'écriture (résolu à la frame suivante)
+    if (Shot.PenetrationsLeft > 0 && Hit.Distance + HitscanSubsystem::PenetrationStep < Shot.Range)
+    {
+        FHitscanShot Continuation = Shot;
+        Continuation.PenetratedActor = Hit.GetActor();
+        Continuation.Start = Hit.ImpactPoint + Shot.Direction * HitscanSubsystem::PenetrationStep;
+        Continuation.Range = Shot.Range - Hit.Distance - HitscanSubsystem::PenetrationStep;
+        Continuation.DistanceTravelled = Distance + HitscanSubsystem::PenetrationStep;
+        Continuation.Damage = Shot.Damage * Shot.PenetrationDamageMultiplier;
+        --Continuation.PenetrationsLeft;
+        QueueShot(Continuation);
+    }
+}
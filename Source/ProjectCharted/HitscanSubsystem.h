@@ -0,0 +1,100 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "HitscanSubsystem.generated.h"
+
+class AWeapon;
+class AProjectChartedCharacter;
+
+/**
+ * Tir hitscan en attente de résolution
+ */
+struct FHitscanShot
+{
+    // Arme ayant tiré
+    TWeakObjectPtr<AWeapon> Weapon;
+
+    // Pawn à l'origine du tir (ignoré par la trace)
+    TWeakObjectPtr<AActor> Instigator;
+
+    // Identifiant du tir (compteur de l'arme), renvoyé au tireur lors de la confirmation
+    int32 ShotId = INDEX_NONE;
+
+    // Dernier acteur traversé (pénétration)
+    TWeakObjectPtr<AActor> PenetratedActor;
+
+    FVector Start = FVector::ZeroVector;
+    FVector Direction = FVector::ForwardVector;
+    float Range = 0.f;
+    float Damage = 0.f;
+    float Impulse = 0.f;
+
+    // Atténuation des dégâts avec la distance totale parcourue
+    float FalloffStart = 0.f;
+    float FalloffEnd = 0.f;
+    float MinDamageMultiplier = 1.f;
+    float DistanceTravelled = 0.f;
+
+    // Traversées restantes et fraction des dégâts conservée à chacune
+    uint8 PenetrationsLeft = 0;
+    float PenetrationDamageMultiplier = 1.f;
+
+    // Instant serveur vu par le tireur distant : les personnages y sont rembobinés (négatif : monde actuel)
+    double RewindTime = -1.0;
+};
+
+/**
+ * Sous-système serveur qui regroupe tous les tirs hitscan d'une frame (toutes armes confondues)
+ * et les résout en un seul lot de traces asynchrones. Les dégâts repassent par ICombatDamageable.
+ * Les tirs rembobinés ignorent les personnages dans la trace et les testent dans leur pose passée.
+ */
+UCLASS()
+class UHitscanSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Ajoute un tir au lot de la frame courante (serveur uniquement)
+    void QueueShot(const FHitscanShot& Shot);
+
+    // Nombre de tirs en attente pour la frame courante
+    int32 GetNumQueuedShots() const { return Batches[WriteBatch].Num(); }
+
+    // Personnages dont l'historique de poses sert aux tirs rembobinés (serveur uniquement)
+    void RegisterRewindTarget(AProjectChartedCharacter* Character);
+    void UnregisterRewindTarget(AProjectChartedCharacter* Character);
+
+    // UTickableWorldSubsystem
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    // Lance les traces asynchrones pour tout le lot courant
+    void FlushBatch();
+
+    // Appelé par le moteur au début de la frame suivante, une fois la trace terminée
+    void OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+    // Applique les dégâts d'un tir résolu et relance le tir s'il traverse la surface
+    void ResolveShot(const FHitscanShot& Shot, const FHitResult& Hit);
+
+    // Personnage rembobiné le plus proche touché par le tir avant MaxDistance
+    bool FindRewoundHit(const FHitscanShot& Shot, float MaxDistance, FHitResult& OutHit) const;
+
+    // Double tampon : un lot se remplit pendant que l'autre attend ses résultats
+    TArray<FHitscanShot> Batches[2];
+    int32 WriteBatch = 0;
+
+    TArray<TWeakObjectPtr<AProjectChartedCharacter>> RewindTargets;
+
+    FTraceDelegate TraceDelegate;
+};
@@ -0,0 +1,93 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LagCompensation.h"
+
+void FPoseHistory::Record(const FPoseSnapshot& Snapshot)
+{
+    if (Num < Capacity)
+    {
+        Snapshots[(Head + Num) % Capacity] = Snapshot;
+        ++Num;
+    }
+    else
+    {
+        // Buffer plein : on écrase la plus ancienne pose
+        Snapshots[Head] = Snapshot;
+        Head = (Head + 1) % Capacity;
+    }
+}
+
+bool FPoseHistory::Sample(double Time, FPoseSnapshot& OutSnapshot) const
+{
+    if (Num == 0)
+    {
+        return false;
+    }
+
+    // Hors de l'historique : on borne à la pose la plus ancienne / la plus récente
+    if (Time <= At(0).Time)
+    {
+        OutSnapshot = At(0);
+        return true;
+    }
+    if (Time >= At(Num - 1).Time)
+    {
+        OutSnapshot = At(Num - 1);
+        return true;
+    }
+
+    // Recherche dichotomique de l'intervalle [Low, Low + 1] contenant Time
+    int32 Low = 0;
+    int32 High = Num - 1;
+    while (High - Low > 1)
+    {
+        const int32 Mid = (Low + High) / 2;
+        if (At(Mid).Time <= Time)
+        {
+            Low = Mid;
+        }
+        else
+        {
+            High = Mid;
+        }
+    }
+
+    const FPoseSnapshot& A = At(Low);
+    const FPoseSnapshot& B = At(High);
+    const float Alpha = float((Time - A.Time) / FMath::Max(B.Time - A.Time, UE_DOUBLE_SMALL_NUMBER));
+
+    OutSnapshot.Time = Time;
+    OutSnapshot.CapsuleCenter = FMath::Lerp(A.CapsuleCenter, B.CapsuleCenter, Alpha);
+    OutSnapshot.HeadCenter = FMath::Lerp(A.HeadCenter, B.HeadCenter, Alpha);
+    OutSnapshot.CapsuleRadius = FMath::Lerp(A.CapsuleRadius, B.CapsuleRadius, Alpha);
+    OutSnapshot.CapsuleHalfHeight = FMath::Lerp(A.CapsuleHalfHeight, B.CapsuleHalfHeight, Alpha);
+    return true;
+}
+
+bool LagCompensation::SegmentHitsPose(const FPoseSnapshot& Pose, const FVector& Start, const FVector& End, float HeadRadius, float Tolerance, FVector& OutImpactPoint)
+{
+    bool bHit = false;
+    double BestDistSquared = TNumericLimits<double>::Max();
+
+    // Tête : distance point / segment
+    const FVector OnShotHead = FMath::ClosestPointOnSegment(FVector(Pose.HeadCenter), Start, End);
+    if (FVector::DistSquared(OnShotHead, FVector(Pose.HeadCenter)) <= FMath::Square(HeadRadius + Tolerance))
+    {
+        OutImpactPoint = OnShotHead;
+        BestDistSquared = FVector::DistSquared(Start, OnShotHead);
+        bHit = true;
+    }
+
+    // Capsule verticale : distance entre le segment du tir et l'axe de la capsule
+    const FVector Center(Pose.CapsuleCenter);
+    const FVector AxisExtent(0.f, 0.f, FMath::Max(Pose.CapsuleHalfHeight - Pose.CapsuleRadius, 0.f));
+    FVector OnShot, OnAxis;
+    FMath::SegmentDistToSegmentSafe(Start, End, Center - AxisExtent, Center + AxisExtent, OnShot, OnAxis);
+    if (FVector::DistSquared(OnShot, OnAxis) <= FMath::Square(Pose.CapsuleRadius + Tolerance)
+        && FVector::DistSquared(Start, OnShot) < BestDistSquared)
+    {
+        OutImpactPoint = OnShot;
+        bHit = true;
+    }
+    return bHit;
+}
@@ -0,0 +1,56 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+
+/**
+ * Pose enregistrée d'un personnage à un instant serveur donné (capsule + hitbox de la tête)
+ */
+struct FPoseSnapshot
+{
+    double Time = 0.0;
+    FVector3f CapsuleCenter = FVector3f::ZeroVector;
+    FVector3f HeadCenter = FVector3f::ZeroVector;
+    float CapsuleRadius = 0.f;
+    float CapsuleHalfHeight = 0.f;
+};
+
+/**
+ * Historique circulaire de poses à capacité fixe.
+ * Stockage contigu, aucune allocation par frame : l'enregistrement écrase simplement la plus ancienne pose.
+ */
+class FPoseHistory
+{
+public:
+    // ~1 s d'historique à 60 Hz
+    static constexpr int32 Capacity = 64;
+
+    // Ajoute une pose (les temps doivent être croissants)
+    void Record(const FPoseSnapshot& Snapshot);
+
+    // Interpole la pose à l'instant demandé ; faux si l'historique est vide
+    bool Sample(double Time, FPoseSnapshot& OutSnapshot) const;
+
+    // Vide l'historique (respawn, téléportation)
+    void Reset() { Head = 0; Num = 0; }
+
+    int32 GetNum() const { return Num; }
+    double GetOldestTime() const { return Num > 0 ? At(0).Time : 0.0; }
+
+private:
+    // Accès par âge : 0 = plus ancienne pose, Num - 1 = plus récente
+    const FPoseSnapshot& At(int32 Age) const { return Snapshots[(Head + Age) % Capacity]; }
+
+    TStaticArray<FPoseSnapshot, Capacity> Snapshots;
+    int32 Head = 0;
+    int32 Num = 0;
+};
+
+namespace LagCompensation
+{
+    // Teste un segment contre la capsule et la tête d'une pose rembobinée ;
+    // OutImpactPoint reçoit le point du segment le plus proche de la partie touchée la plus près de Start
+    bool SegmentHitsPose(const FPoseSnapshot& Pose, const FVector& Start, const FVector& End, float HeadRadius, float Tolerance, FVector& OutImpactPoint);
+}
@@ -0,0 +1,220 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "NetBandwidthProfiler.h"
+#include "ReplicatedAim.h"
+#include "Containers/Ticker.h"
+#include "Engine/NetConnection.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogNetBandwidth, Log, All);
+
+CSV_DEFINE_CATEGORY(NetBandwidth, false);
+
+DECLARE_STATS_GROUP(TEXT("NetBandwidth"), STATGROUP_NetBandwidth, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Property bytes/s"), STAT_NetBandwidth_PropertyBytes, STATGROUP_NetBandwidth);
+DECLARE_DWORD_COUNTER_STAT(TEXT("RPC bytes/s"), STAT_NetBandwidth_RPCBytes, STATGROUP_NetBandwidth);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Movement bytes/s"), STAT_NetBandwidth_MovementBytes, STATGROUP_NetBandwidth);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Players over budget"), STAT_NetBandwidth_PlayersOverBudget, STATGROUP_NetBandwidth);
+
+namespace NetBandwidth
+{
+    static int32 GEnable = 0;
+    static FAutoConsoleVariableRef CVarEnable(
+        TEXT("net.Bandwidth.Enable"),
+        GEnable,
+        TEXT("Active les compteurs de bande passante par classe, propriété et RPC."));
+
+    static int32 GBudgetBytesPerSecond = 0;
+    static FAutoConsoleVariableRef CVarBudget(
+        TEXT("net.Bandwidth.BudgetBytesPerSecond"),
+        GBudgetBytesPerSecond,
+        TEXT("Budget par joueur (RPC et mouvement, octets/s) ; 0 = aucun contrôle."));
+
+    struct FCounter
+    {
+        // Nom affiché et colonne CSV : Classe ou Classe.Membre
+        FName StatName;
+        ENetBandwidthKind Kind = ENetBandwidthKind::Property;
+        bool bClassTotal = false;
+        // Bits de la seconde en cours, de la dernière seconde complète et depuis le début
+        int64 WindowBits = 0;
+        int64 LastSecondBits = 0;
+        int64 TotalBits = 0;
+        int64 TotalCount = 0;
+    };
+
+    class FProfiler
+    {
+    public:
+        static FProfiler& Get()
+        {
+            static FProfiler Instance;
+            return Instance;
+        }
+
+        void Record(ENetBandwidthKind Kind, FName ClassName, FName MemberName, int64 Bits, const AActor* Owner)
+        {
+            check(IsInGameThread());
+            EnsureTicker();
+
+            Add(ClassName, NAME_None, Kind, Bits);
+            Add(ClassName, MemberName, Kind, Bits);
+            KindWindowBits[int32(Kind)] += Bits;
+
+            // Seuls les RPC et le mouvement sont propres à une connexion ; les propriétés partent vers toutes
+            if (Kind != ENetBandwidthKind::Property && Owner)
+            {
+                if (UNetConnection* Connection = Owner->GetNetConnection())
+                {
+                    PlayerWindowBits.FindOrAdd(Connection) += Bits;
+                }
+            }
+        }
+
+        void Dump(int32 MaxEntries) const
+        {
+            TArray<const FCounter*> Sorted;
+            Sorted.Reserve(Counters.Num());
+            for (const TPair<FCounterKey, FCounter>& Pair : Counters)
+            {
+                Sorted.Add(&Pair.Value);
+            }
+            Sorted.Sort([](const FCounter& A, const FCounter& B)
+            {
+                return A.LastSecondBits != B.LastSecondBits ? A.LastSecondBits > B.LastSecondBits : A.TotalBits > B.TotalBits;
+            });
+
+            static const TCHAR* KindNames[] = { TEXT("Property"), TEXT("RPC"), TEXT("Movement") };
+
+            UE_LOG(LogNetBandwidth, Display, TEXT("Net bandwidth: top %d of %d counters (budget %d B/s per player)"), MaxEntries, Sorted.Num(), GBudgetBytesPerSecond);
+            UE_LOG(LogNetBandwidth, Display, TEXT("%-60s %-9s %10s %12s %10s %8s"), TEXT("Name"), TEXT("Kind"), TEXT("B/s"), TEXT("Total B"), TEXT("Count"), TEXT("B/send"));
+            for (int32 Index = 0; Index < FMath::Min(MaxEntries, Sorted.Num()); ++Index)
+            {
+                const FCounter& Counter = *Sorted[Index];
+                UE_LOG(LogNetBandwidth, Display, TEXT("%-60s %-9s %10lld %12lld %10lld %8.1f"),
+                    *Counter.StatName.ToString(), Counter.bClassTotal ? TEXT("Class") : KindNames[int32(Counter.Kind)],
+                    Counter.LastSecondBits / 8, Counter.TotalBits / 8, Counter.TotalCount,
+                    Counter.TotalCount > 0 ? double(Counter.TotalBits) / (8.0 * Counter.TotalCount) : 0.0);
+            }
+        }
+
+        void Reset()
+        {
+            Counters.Reset();
+            PlayerWindowBits.Reset();
+            FMemory::Memzero(KindWindowBits);
+        }
+
+    private:
+        void Add(FName ClassName, FName MemberName, ENetBandwidthKind Kind, int64 Bits)
+        {
+            const FCounterKey Key(ClassName, MemberName);
+            FCounter* Found = Counters.Find(Key);
+            if (!Found)
+            {
+                Found = &Counters.Add(Key);
+                Found->bClassTotal = MemberName.IsNone();
+                Found->StatName = Found->bClassTotal ? ClassName : FName(*FString::Printf(TEXT("%s.%s"), *ClassName.ToString(), *MemberName.ToString()));
+            }
+            FCounter& Counter = *Found;
+            Counter.Kind = Kind;
+            Counter.WindowBits += Bits;
+            Counter.TotalBits += Bits;
+            ++Counter.TotalCount;
+        }
+
+        void EnsureTicker()
+        {
+            if (!TickerHandle.IsValid())
+            {
+                LastRollTime = FPlatformTime::Seconds();
+                TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FProfiler::Roll), 1.f);
+            }
+        }
+
+        // Clôt la fenêtre d'une seconde : stats, colonnes CSV et contrôle du budget par joueur
+        bool Roll(float)
+        {
+            // Le ticker passe le delta de la frame, pas la durée écoulée depuis le dernier appel
+            const double Now = FPlatformTime::Seconds();
+            const double Scale = Now > LastRollTime ? 1.0 / (Now - LastRollTime) : 1.0;
+            LastRollTime = Now;
+
+            for (TPair<FCounterKey, FCounter>& Pair : Counters)
+            {
+                FCounter& Counter = Pair.Value;
+                Counter.LastSecondBits = int64(Counter.WindowBits * Scale);
+                Counter.WindowBits = 0;
+#if CSV_PROFILER
+                FCsvProfiler::RecordCustomStat(Counter.StatName, CSV_CATEGORY_INDEX(NetBandwidth), float(Counter.LastSecondBits / 8), ECsvCustomStatOp::Set);
+#endif
+            }
+
+            SET_DWORD_STAT(STAT_NetBandwidth_PropertyBytes, int64(KindWindowBits[int32(ENetBandwidthKind::Property)] * Scale) / 8);
+            SET_DWORD_STAT(STAT_NetBandwidth_RPCBytes, int64(KindWindowBits[int32(ENetBandwidthKind::RPC)] * Scale) / 8);
+            SET_DWORD_STAT(STAT_NetBandwidth_MovementBytes, int64(KindWindowBits[int32(ENetBandwidthKind::Movement)] * Scale) / 8);
+            FMemory::Memzero(KindWindowBits);
+
+            int32 PlayersOverBudget = 0;
+            for (const TPair<TWeakObjectPtr<UNetConnection>, int64>& Pair : PlayerWindowBits)
+            {
+                const int64 BytesPerSecond = int64(Pair.Value * Scale) / 8;
+                if (GBudgetBytesPerSecond > 0 && BytesPerSecond > GBudgetBytesPerSecond)
+                {
+                    ++PlayersOverBudget;
+                    UE_LOG(LogNetBandwidth, Warning, TEXT("%s over budget: %lld B/s (budget %d B/s)"),
+                        Pair.Key.IsValid() ? *Pair.Key->Describe() : TEXT("<closed connection>"), BytesPerSecond, GBudgetBytesPerSecond);
+                }
+            }
+            PlayerWindowBits.Reset();
+
+            SET_DWORD_STAT(STAT_NetBandwidth_PlayersOverBudget, PlayersOverBudget);
+            CSV_CUSTOM_STAT(NetBandwidth, PlayersOverBudget, PlayersOverBudget, ECsvCustomStatOp::Set);
+
+            return true;
+        }
+
+        // Membre NAME_None : total de la classe
+        using FCounterKey = TPair<FName, FName>;
+
+        TMap<FCounterKey, FCounter> Counters;
+        TMap<TWeakObjectPtr<UNetConnection>, int64> PlayerWindowBits;
+        int64 KindWindowBits[3] = {};
+        double LastRollTime = 0.0;
+        FTSTicker::FDelegateHandle TickerHandle;
+    };
+
+    static FAutoConsoleCommand DumpCommand(
+        TEXT("net.Bandwidth.Dump"),
+        TEXT("Affiche les plus gros consommateurs de bande passante. Argument : nombre de lignes (20 par défaut)."),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            FProfiler::Get().Dump(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 20);
+        }));
+
+    static FAutoConsoleCommand ResetCommand(
+        TEXT("net.Bandwidth.Reset"),
+        TEXT("Remet à zéro les compteurs de bande passante."),
+        FConsoleCommandDelegate::CreateLambda([]()
+        {
+            FProfiler::Get().Reset();
+        }));
+
+    bool IsEnabled()
+    {
+        return GEnable != 0;
+    }
+
+    void Record(ENetBandwidthKind Kind, FName ClassName, FName MemberName, int64 Bits, const AActor* Owner)
+    {
+        FProfiler::Get().Record(Kind, ClassName, MemberName, Bits, Owner);
+    }
+
+    int64 MeasureBits(const FReplicatedAim& Value)
+    {
+        return MeasureNetSerializeBits(Value);
+    }
+}
@@ -0,0 +1,90 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/NetSerialization.h"
+#include "UObject/CoreNet.h"
+
+class AActor;
+struct FReplicatedAim;
+
+/**
+ * Compteurs de bande passante du module, par classe, par propriété, par RPC et pour le mouvement.
+ * Les coûts sont relevés aux points d'envoi du code du jeu, avant en-têtes de paquet et
+ * multiplication par le nombre de connexions ; les RPC client -> serveur et le mouvement sont aussi
+ * relevés à leur réception sur le serveur, qui contrôle ainsi le budget de chaque joueur. Le coût réel
+ * par classe côté serveur est en plus suivi par le graphe de réplication (catégorie CSV ReplicationGraph).
+ *
+ * Désactivé par défaut : net.Bandwidth.Enable 1, puis
+ *   net.Bandwidth.Dump [N]   les N plus gros consommateurs sur la dernière seconde et depuis le début
+ *   net.Bandwidth.Reset      remise à zéro
+ *   stat NetBandwidth        totaux par seconde
+ *   csvcategory NetBandwidth une colonne CSV par compteur
+ * net.Bandwidth.BudgetBytesPerSecond signale chaque joueur dont les RPC et le mouvement dépassent le budget.
+ */
+enum class ENetBandwidthKind : uint8
+{
+    Property,
+    RPC,
+    Movement,
+};
+
+namespace NetBandwidth
+{
+    // Estimation d'une référence d'objet répliquée (NetGUID compressé)
+    constexpr int64 ObjectReferenceBits = 32;
+
+    bool IsEnabled();
+
+    // Ajoute Bits au compteur Class.Member et au total de Class ; Owner attribue le coût au joueur qui le possède
+    void Record(ENetBandwidthKind Kind, FName ClassName, FName MemberName, int64 Bits, const AActor* Owner = nullptr);
+
+    inline int64 MeasureBits(bool) { return 1; }
+    inline int64 MeasureBits(uint8) { return 8; }
+    inline int64 MeasureBits(int32) { return 32; }
+    inline int64 MeasureBits(uint32) { return 32; }
+    inline int64 MeasureBits(float) { return 32; }
+    inline int64 MeasureBits(const UObject*) { return ObjectReferenceBits; }
+
+    // Types quantifiés : taille exacte de leur NetSerialize
+    template<typename T>
+    int64 MeasureNetSerializeBits(const T& Value)
+    {
+        FNetBitWriter Writer(nullptr, 0);
+        bool bOutSuccess = true;
+        const_cast<T&>(Value).NetSerialize(Writer, nullptr, bOutSuccess);
+        return Writer.GetNumBits();
+    }
+
+    inline int64 MeasureBits(const FVector_NetQuantize& Value) { return MeasureNetSerializeBits(Value); }
+    inline int64 MeasureBits(const FVector_NetQuantizeNormal& Value) { return MeasureNetSerializeBits(Value); }
+    int64 MeasureBits(const FReplicatedAim& Value);
+
+    // Taille cumulée des paramètres d'un RPC
+    template<typename... ArgTypes>
+    int64 MeasureParamsBits(const ArgTypes&... Params)
+    {
+        return (int64(0) + ... + MeasureBits(Params));
+    }
+}
+
+// Compte une propriété répliquée modifiée (à placer à côté du MARK_PROPERTY_DIRTY correspondant)
+#define NET_BANDWIDTH_RECORD_PROPERTY(ClassName, PropertyName, Object) \
+    do \
+    { \
+        if (!NetBandwidth::IsEnabled()) break; \
+        static const FName BandwidthClassName(TEXT(#ClassName)); \
+        static const FName BandwidthMemberName(GET_MEMBER_NAME_CHECKED(ClassName, PropertyName)); \
+        NetBandwidth::Record(ENetBandwidthKind::Property, BandwidthClassName, BandwidthMemberName, NetBandwidth::MeasureBits((Object)->PropertyName), (Object)); \
+    } while (0)
+
+// Compte un RPC au moment de son appel, paramètres compris ; les RPC serveur le sont aussi dans leur _Implementation
+#define NET_BANDWIDTH_RECORD_RPC(ClassName, FunctionName, Object, ...) \
+    do \
+    { \
+        if (!NetBandwidth::IsEnabled()) break; \
+        static const FName BandwidthClassName(TEXT(#ClassName)); \
+        static const FName BandwidthMemberName(GET_FUNCTION_NAME_CHECKED(ClassName, FunctionName)); \
+        NetBandwidth::Record(ENetBandwidthKind::RPC, BandwidthClassName, BandwidthMemberName, NetBandwidth::MeasureParamsBits(__VA_ARGS__), (Object)); \
+    } while (0)
@@ -0,0 +1,76 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "PlayerTargetSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+bool UPlayerTargetSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UPlayerTargetSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UPlayerTargetSubsystem, STATGROUP_Tickables);
+}
+
+void UPlayerTargetSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // Les IA qui démarrent avec le niveau ont leurs cibles dès la première frame
+    RefreshTargets();
+}
+
+void UPlayerTargetSubsystem::Deinitialize()
+{
+    Locations.Empty();
+    Velocities.Empty();
+    Pawns.Empty();
+    Super::Deinitialize();
+}
+
+void UPlayerTargetSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+    RefreshTargets();
+}
+
+void UPlayerTargetSubsystem::RefreshTargets()
+{
+    // Même capacité d'une frame à l'autre : aucune allocation tant que le nombre de joueurs ne change pas
+    Locations.Reset();
+    Velocities.Reset();
+    Pawns.Reset();
+
+    for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PlayerController = It->Get();
+        APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+        if (!IsValid(Pawn)) continue;
+
+        Locations.Add(Pawn->GetActorLocation());
+        Velocities.Add(Pawn->GetVelocity());
+        Pawns.Add(Pawn);
+    }
+}
+
+int32 UPlayerTargetSubsystem::FindNearestTarget(const FVector& Location, float MaxDistance, float& OutDistance) const
+{
+    int32 Nearest = INDEX_NONE;
+    double NearestDistSq = FMath::Square(double(MaxDistance));
+
+    for (int32 Index = 0; Index < Locations.Num(); ++Index)
+    {
+        const double DistSq = FVector::DistSquared(Locations[Index], Location);
+        if (DistSq < NearestDistSq)
+        {
+            NearestDistSq = DistSq;
+            Nearest = Index;
+        }
+    }
+
+    OutDistance = Nearest != INDEX_NONE ? float(FMath::Sqrt(NearestDistSq)) : MaxDistance;
+    return Nearest;
+}
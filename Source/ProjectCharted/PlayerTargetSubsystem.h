@@ -0,0 +1,50 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PlayerTargetSubsystem.generated.h"
+
+/**
+ * Cibles joueurs partagées par toutes les IA du monde.
+ * Les pawns de tous les contrôleurs joueurs (locaux et distants) sont relevés une fois par frame
+ * dans des tableaux compacts de positions et de vitesses, lus ensuite par index : une IA ne parcourt
+ * que ces tableaux au lieu de refaire la recherche globale du joueur à chaque tick de StateTree.
+ */
+UCLASS()
+class UPlayerTargetSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    int32 GetNumTargets() const { return Locations.Num(); }
+
+    // Valeurs relevées au début de la frame ; Index dans [0, GetNumTargets())
+    const FVector& GetTargetLocation(int32 Index) const { return Locations[Index]; }
+    const FVector& GetTargetVelocity(int32 Index) const { return Velocities[Index]; }
+
+    // Pawn de la cible, nul s'il a été détruit depuis le relevé
+    APawn* GetTargetPawn(int32 Index) const { return Pawns[Index].Get(); }
+
+    // Index de la cible la plus proche de Location à moins de MaxDistance, ou INDEX_NONE ; OutDistance reçoit sa distance
+    int32 FindNearestTarget(const FVector& Location, float MaxDistance, float& OutDistance) const;
+
+    // UTickableWorldSubsystem
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    // Relève les pawns joueurs et leur état
+    void RefreshTargets();
+
+    // Tableaux parallèles, un élément par cible
+    TArray<FVector> Locations;
+    TArray<FVector> Velocities;
+    TArray<TWeakObjectPtr<APawn>> Pawns;
+};
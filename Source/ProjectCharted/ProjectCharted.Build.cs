@@ -12,12 +12,15 @@ public class ProjectCharted : ModuleRules
 			"Core",
 			"CoreUObject",
 			"Engine",
+			"NetCore",
 			"InputCore",
 			"EnhancedInput",
 			"AIModule",
 			"StateTreeModule",
 			"GameplayStateTreeModule",
-			"UMG"
+			"UMG",
+			"SignificanceManager",
+			"ReplicationGraph"
 		});
 
 		PrivateDependencyModuleNames.AddRange(new string[] { });
@@ -1,22 +1,48 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "ProjectChartedCharacter.h"
-#include "Engine/LocalPlayer.h"
 #include "Camera/CameraComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "GameFramework/Controller.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "GameFramework/PlayerController.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
-#include "UObject/ConstructorHelpers.h"
+#include "Engine/AssetManager.h"
+#include "Animation/AnimInstance.h"
 #include "Engine/SkeletalMesh.h"
 #include "Components/InputComponent.h"
+#include "EnhancedInputComponent.h"
+#include "InputAction.h"
+#include "InputActionValue.h"
+#include "GameFramework/PlayerState.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/GameStateBase.h"
+#include "Engine/DamageEvents.h"
+#include "TimerManager.h"
+#include "HitscanSubsystem.h"
+#include "WeaponPoolSubsystem.h"
+#include "WeaponPickupSubsystem.h"
+#include "ProjectChartedMovementComponent.h"
+#include "ProjectChartedSignificanceManager.h"
+#include "NetBandwidthProfiler.h"
+#include "ProjectChartedPlayerController.h"
+
+namespace CharacterInput
+{
+    // Action assignée, sinon l'asset du template (chargé à la mise en place des entrées du joueur local)
+    UInputAction* Resolve(UInputAction* Action, const TCHAR* DefaultPath)
+    {
+        return Action ? Action : TSoftObjectPtr<UInputAction>(FSoftObjectPath(DefaultPath)).LoadSynchronous();
+    }
+}
 
-AProjectChartedCharacter::AProjectChartedCharacter()
+AProjectChartedCharacter::AProjectChartedCharacter(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer.SetDefaultSubobjectClass<UProjectChartedMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
     // Capsule
     GetCapsuleComponent()->InitCapsuleSize(42.f, 96.0f);
@@ -24,37 +50,21 @@ AProjectChartedCharacter::AProjectChartedCharacter()
     // Camera boom
     CameraBoom = CreateDefaultSubobject<USpringArmComponent>(TEXT("CameraBoom"));
     CameraBoom->SetupAttachment(RootComponent);
-    DefaultArmLength = 350.0f; // Un peu plus loin par dfaut
-    AimArmLength = 160.0f;    // Plus proche en vise
-    CameraBoom->TargetArmLength = DefaultArmLength;
+    CameraBoom->TargetArmLength = 350.0f; // Un peu plus loin par défaut
     CameraBoom->bUsePawnControlRotation = true;
-    // Nouvelle position centre derrire le personnage
-    DefaultSocketOffset = FVector(30.f, 75.f, 75.f); // Y=75 pour camra paule droite (plus proche de la gauche)
-    AimSocketOffset = FVector(50.f, 80.f, 80.f);    // Y=80 pour vise  droite, Z=80 pour surlever
-    DefaultSocketOffsetLeft = FVector(30.f, -75.f, 75.f); // Y=-75 pour camra paule gauche
-    AimSocketOffsetLeft = FVector(50.f, -80.f, 80.f);    // Y=-80 pour vise  gauche, Z=80 pour surlever
-    CameraBoom->SocketOffset = DefaultSocketOffset;
+    CameraBoom->SocketOffset = FVector(30.f, 75.f, 75.f); // Épaule droite
     CameraBoom->bEnableCameraLag = true;
     CameraBoom->CameraLagSpeed = 10.0f;
 
-    // Camera paule droite
-    RightShoulderCamera = CreateDefaultSubobject<UCameraComponent>(TEXT("RightShoulderCamera"));
-    RightShoulderCamera->SetupAttachment(CameraBoom, USpringArmComponent::SocketName);
-    DefaultFOV = 90.0f;
-    AimFOV = 58.0f; // FOV plus serr en vise
-    RightShoulderCamera->FieldOfView = DefaultFOV;
-    RightShoulderCamera->bUsePawnControlRotation = false;
-    RightShoulderCamera->SetActive(true);
-
-    // Camera paule gauche
-    LeftShoulderCamera = CreateDefaultSubobject<UCameraComponent>(TEXT("LeftShoulderCamera"));
-    LeftShoulderCamera->SetupAttachment(CameraBoom, USpringArmComponent::SocketName);
-    LeftShoulderCamera->FieldOfView = DefaultFOV;
-    LeftShoulderCamera->bUsePawnControlRotation = false;
-    LeftShoulderCamera->SetActive(false);
-
-    bIsAiming = false;
-    AimInterpSpeed = 10.0f;
+    // Caméra unique : changer d'épaule ne fait que déplacer le bras
+    FollowCamera = CreateDefaultSubobject<UCameraComponent>(TEXT("FollowCamera"));
+    FollowCamera->SetupAttachment(CameraBoom, USpringArmComponent::SocketName);
+    FollowCamera->FieldOfView = 90.0f;
+    FollowCamera->bUsePawnControlRotation = false;
+
+    // Rig : longueur du bras, décalage, FOV et épaule (valeurs réglables sur le composant)
+    CameraRig = CreateDefaultSubobject<UCameraRigComponent>(TEXT("CameraRig"));
+    CameraRig->SetRig(CameraBoom, FollowCamera);
 
     // Mouvement
     bUseControllerRotationYaw = false;
@@ -63,19 +73,13 @@ AProjectChartedCharacter::AProjectChartedCharacter()
     GetCharacterMovement()->bOrientRotationToMovement = true;
     GetCharacterMovement()->RotationRate = FRotator(0.f, 540.f, 0.f);
 
-    // Mouvement fluide orient vers la direction du dplacement (style Uncharted)
+    // Mouvement fluide orienté vers la direction du déplacement (style Uncharted)
     bUseControllerRotationYaw = false;
     bUseControllerRotationPitch = false;
     bUseControllerRotationRoll = false;
     GetCharacterMovement()->bOrientRotationToMovement = true;
     GetCharacterMovement()->RotationRate = FRotator(0.f, 540.f, 0.f); // Rotation rapide et naturelle
 
-    // ADS
-    bIsAiming = false;
-    DefaultFOV = 90.f;
-    AimFOV = 60.f;
-    AimInterpSpeed = 10.f;
-
     // Note: For faster iteration times these variables, and many more, can be tweaked in the Character Blueprint
     // instead of recompiling to adjust them
     GetCharacterMovement()->JumpZVelocity = 500.f;
@@ -85,20 +89,11 @@ AProjectChartedCharacter::AProjectChartedCharacter()
     GetCharacterMovement()->BrakingDecelerationWalking = 2000.f;
     GetCharacterMovement()->BrakingDecelerationFalling = 1500.0f;
 
-    // Affecte le mesh squelette du personnage (SKM_Manny_Simple)
-    static ConstructorHelpers::FObjectFinder<USkeletalMesh> MeshObj(TEXT("/Game/Characters/Mannequins/Meshes/SKM_Manny_Simple.SKM_Manny_Simple"));
-    if (MeshObj.Succeeded())
-    {
-        GetMesh()->SetSkeletalMesh(MeshObj.Object);
-        GetMesh()->SetRelativeLocation(FVector(0.f, 0.f, -90.f));
-        GetMesh()->SetRelativeRotation(FRotator(0.f, -90.f, 0.f));
-        // Affecte le Blueprint d'animation Unarmed
-        static ConstructorHelpers::FClassFinder<UAnimInstance> AnimBPClass(TEXT("/Game/Characters/Mannequins/Anims/Unarmed/ABP_Unarmed.ABP_Unarmed_C"));
-        if (AnimBPClass.Succeeded())
-        {
-            GetMesh()->SetAnimInstanceClass(AnimBPClass.Class);
-        }
-    }
+    // Mesh squelette (SKM_Manny_Simple) et animation Unarmed : simples chemins, chargés au BeginPlay
+    CharacterMesh = TSoftObjectPtr<USkeletalMesh>(FSoftObjectPath(TEXT("/Game/Characters/Mannequins/Meshes/SKM_Manny_Simple.SKM_Manny_Simple")));
+    CharacterAnimClass = TSoftClassPtr<UAnimInstance>(FSoftObjectPath(TEXT("/Game/Characters/Mannequins/Anims/Unarmed/ABP_Unarmed.ABP_Unarmed_C")));
+    GetMesh()->SetRelativeLocation(FVector(0.f, 0.f, -90.f));
+    GetMesh()->SetRelativeRotation(FRotator(0.f, -90.f, 0.f));
 
     bReplicates = true;
     CurrentWeapon = nullptr;
@@ -108,15 +103,45 @@ void AProjectChartedCharacter::BeginPlay()
 {
     Super::BeginPlay();
 
-    if (HasAuthority() && !CurrentWeapon)
+    // Assets déjà en mémoire (préchargés par l'état de jeu) : affectation immédiate, sinon chargement asynchrone
+    TArray<FSoftObjectPath> AssetsToLoad;
+    if (!GetMeshToLoad().IsNull() && !GetMeshToLoad().IsValid())
+    {
+        AssetsToLoad.Add(GetMeshToLoad().ToSoftObjectPath());
+    }
+    if (!GetAnimClassToLoad().IsNull() && !GetAnimClassToLoad().IsValid())
     {
-        // Spawn l'arme ct serveur uniquement
-        FActorSpawnParameters SpawnParams;
-        SpawnParams.Owner = this;
-        SpawnParams.Instigator = this;
-        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        AssetsToLoad.Add(GetAnimClassToLoad().ToSoftObjectPath());
+    }
 
-        CurrentWeapon = GetWorld()->SpawnActor<AWeapon>(AWeapon::StaticClass(), FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+    if (AssetsToLoad.IsEmpty())
+    {
+        OnCharacterAssetsLoaded();
+    }
+    else
+    {
+        MeshLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+            MoveTemp(AssetsToLoad), FStreamableDelegate::CreateUObject(this, &AProjectChartedCharacter::OnCharacterAssetsLoaded));
+    }
+
+    if (HasAuthority())
+    {
+        SetCurrentHP(MaxHP);
+
+        // Cible des tirs rembobinés des joueurs distants
+        if (UHitscanSubsystem* Hitscan = GetWorld()->GetSubsystem<UHitscanSubsystem>())
+        {
+            Hitscan->RegisterRewindTarget(this);
+        }
+    }
+
+    if (HasAuthority() && !CurrentWeapon)
+    {
+        // Arme de départ prise dans le pool côté serveur uniquement
+        if (UWeaponPoolSubsystem* WeaponPool = GetWorld()->GetSubsystem<UWeaponPoolSubsystem>())
+        {
+            SetCurrentWeapon(WeaponPool->AcquireWeapon(AWeapon::StaticClass(), this));
+        }
         if (CurrentWeapon)
         {
             AttachWeaponToSocket();
@@ -127,54 +152,255 @@ void AProjectChartedCharacter::BeginPlay()
         AttachWeaponToSocket();
     }
 
-    // Initialiser le FOV par dfaut
-    if (RightShoulderCamera)
+    // Fréquences de tick et d'animation selon la significativité
+    UProjectChartedSignificanceManager::RegisterCharacter(this);
+
+    DisplayedAimRotation = GetActorRotation();
+}
+
+const TSoftObjectPtr<USkeletalMesh>& AProjectChartedCharacter::GetMeshToLoad() const
+{
+    return Definition && !Definition->Mesh.IsNull() ? Definition->Mesh : CharacterMesh;
+}
+
+const TSoftClassPtr<UAnimInstance>& AProjectChartedCharacter::GetAnimClassToLoad() const
+{
+    return Definition && !Definition->AnimClass.IsNull() ? Definition->AnimClass : CharacterAnimClass;
+}
+
+void AProjectChartedCharacter::GetCharacterAssetPaths(TArray<FSoftObjectPath>& OutPaths) const
+{
+    if (!GetMeshToLoad().IsNull())
+    {
+        OutPaths.Add(GetMeshToLoad().ToSoftObjectPath());
+    }
+    if (!GetAnimClassToLoad().IsNull())
+    {
+        OutPaths.Add(GetAnimClassToLoad().ToSoftObjectPath());
+    }
+}
+
+void AProjectChartedCharacter::OnCharacterAssetsLoaded()
+{
+    // Le mesh et son animation sont affectés ensemble pour ne jamais animer un mesh incompatible
+    if (USkeletalMesh* Mesh = GetMeshToLoad().Get())
+    {
+        GetMesh()->SetSkeletalMesh(Mesh);
+        if (UClass* AnimClass = GetAnimClassToLoad().Get())
+        {
+            GetMesh()->SetAnimInstanceClass(AnimClass);
+        }
+    }
+}
+
+void AProjectChartedCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (MeshLoadHandle.IsValid())
+    {
+        MeshLoadHandle->CancelHandle();
+        MeshLoadHandle.Reset();
+    }
+
+    // Rendre l'arme au pool plutôt que de la laisser orpheline
+    if (HasAuthority() && CurrentWeapon && EndPlayReason == EEndPlayReason::Destroyed)
+    {
+        if (UWeaponPoolSubsystem* WeaponPool = GetWorld()->GetSubsystem<UWeaponPoolSubsystem>())
+        {
+            WeaponPool->ReleaseWeapon(CurrentWeapon);
+        }
+        SetCurrentWeapon(nullptr);
+    }
+
+    UProjectChartedSignificanceManager::UnregisterCharacter(this);
+
+    if (UHitscanSubsystem* Hitscan = GetWorld()->GetSubsystem<UHitscanSubsystem>())
     {
-        DefaultFOV = RightShoulderCamera->FieldOfView;
+        Hitscan->UnregisterRewindTarget(this);
     }
+    GetWorldTimerManager().ClearTimer(RespawnTimer);
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void AProjectChartedCharacter::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
-    UpdateCameraShoulder(DeltaTime);
-    UpdateAim(DeltaTime);
+
+    // Le serveur garde l'historique des poses pour valider les tirs
+    if (HasAuthority())
+    {
+        RecordPose();
+        UpdateReplicatedAim();
+    }
+    else if (GetLocalRole() == ROLE_SimulatedProxy)
+    {
+        DisplayedAimRotation = FMath::RInterpTo(DisplayedAimRotation, ReplicatedAim.GetRotation(), DeltaTime, AimInterpSpeed);
+    }
+
+    if (IsLocallyControlled())
+    {
+        ProcessFireSchedule();
+    }
 }
 
 void AProjectChartedCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
 {
     Super::SetupPlayerInputComponent(PlayerInputComponent);
 
-    // Dplacement ZQSD/WASD
-    PlayerInputComponent->BindAxis("MoveForward", this, &AProjectChartedCharacter::MoveForward);
-    PlayerInputComponent->BindAxis("MoveRight", this, &AProjectChartedCharacter::MoveRight);
+    UEnhancedInputComponent* EnhancedInputComponent = Cast<UEnhancedInputComponent>(PlayerInputComponent);
+    if (!EnhancedInputComponent) return;
+
+    // Actions d'arme par défaut : sans asset dans le template, elles sont fournies par le PlayerController natif
+    const AProjectChartedPlayerController* PlayerController = Cast<AProjectChartedPlayerController>(GetController());
+    UInputAction* AimInput = AimAction ? AimAction : (PlayerController ? PlayerController->GetAimAction() : nullptr);
+    UInputAction* FireInput = FireAction ? FireAction : (PlayerController ? PlayerController->GetFireAction() : nullptr);
+    UInputAction* ToggleShoulderInput = ToggleShoulderAction ? ToggleShoulderAction : (PlayerController ? PlayerController->GetToggleShoulderAction() : nullptr);
+
+    // Déplacement et caméra : Triggered n'est émis que si l'axe est actionné
+    EnhancedInputComponent->BindAction(CharacterInput::Resolve(MoveAction, TEXT("/Game/Input/Actions/IA_Move.IA_Move")), ETriggerEvent::Triggered, this, &AProjectChartedCharacter::Move);
+    EnhancedInputComponent->BindAction(CharacterInput::Resolve(LookAction, TEXT("/Game/Input/Actions/IA_Look.IA_Look")), ETriggerEvent::Triggered, this, &AProjectChartedCharacter::Look);
+    EnhancedInputComponent->BindAction(CharacterInput::Resolve(MouseLookAction, TEXT("/Game/Input/Actions/IA_MouseLook.IA_MouseLook")), ETriggerEvent::Triggered, this, &AProjectChartedCharacter::Look);
+
+    // Boutons : un appel à l'appui et un au relâchement
+    UInputAction* JumpInput = CharacterInput::Resolve(JumpAction, TEXT("/Game/Input/Actions/IA_Jump.IA_Jump"));
+    EnhancedInputComponent->BindAction(JumpInput, ETriggerEvent::Started, this, &AProjectChartedCharacter::DoJumpStart);
+    EnhancedInputComponent->BindAction(JumpInput, ETriggerEvent::Completed, this, &AProjectChartedCharacter::DoJumpEnd);
 
-    // Camra souris
-    PlayerInputComponent->BindAxis("Turn", this, &AProjectChartedCharacter::Turn);
-    PlayerInputComponent->BindAxis("LookUp", this, &AProjectChartedCharacter::LookUp);
+    EnhancedInputComponent->BindAction(AimInput, ETriggerEvent::Started, this, &AProjectChartedCharacter::DoAimStart);
+    EnhancedInputComponent->BindAction(AimInput, ETriggerEvent::Completed, this, &AProjectChartedCharacter::DoAimEnd);
 
-    // Saut
-    PlayerInputComponent->BindAction("Jump", IE_Pressed, this, &AProjectChartedCharacter::StartJump);
-    PlayerInputComponent->BindAction("Jump", IE_Released, this, &AProjectChartedCharacter::StopJump);
+    EnhancedInputComponent->BindAction(FireInput, ETriggerEvent::Started, this, &AProjectChartedCharacter::DoFireStart);
+    EnhancedInputComponent->BindAction(FireInput, ETriggerEvent::Completed, this, &AProjectChartedCharacter::DoFireEnd);
 
-    // Vise (clic droit)
-    PlayerInputComponent->BindAction("Aim", IE_Pressed, this, &AProjectChartedCharacter::OnAimPressed);
-    PlayerInputComponent->BindAction("Aim", IE_Released, this, &AProjectChartedCharacter::OnAimReleased);
+    EnhancedInputComponent->BindAction(ToggleShoulderInput, ETriggerEvent::Started, this, &AProjectChartedCharacter::DoToggleShoulder);
+}
 
-    // Tir (clic gauche)
-    PlayerInputComponent->BindAction("Fire", IE_Pressed, this, &AProjectChartedCharacter::OnFire);
+void AProjectChartedCharacter::Move(const FInputActionValue& Value)
+{
+    const FVector2D MovementVector = Value.Get<FVector2D>();
+    DoMove(MovementVector.X, MovementVector.Y);
+}
 
-    PlayerInputComponent->BindAction("Aim", IE_Pressed, this, &AProjectChartedCharacter::StartAiming);
-    PlayerInputComponent->BindAction("Aim", IE_Released, this, &AProjectChartedCharacter::StopAiming);
+void AProjectChartedCharacter::Look(const FInputActionValue& Value)
+{
+    const FVector2D LookAxisVector = Value.Get<FVector2D>();
+    DoLook(LookAxisVector.X, LookAxisVector.Y);
+}
+
+void AProjectChartedCharacter::DoMove(float Right, float Forward)
+{
+    if (!Controller) return;
+
+    const FRotator YawRotation(0, Controller->GetControlRotation().Yaw, 0);
+    const FRotationMatrix YawMatrix(YawRotation);
+    AddMovementInput(YawMatrix.GetUnitAxis(EAxis::X), Forward);
+    AddMovementInput(YawMatrix.GetUnitAxis(EAxis::Y), Right);
+}
+
+void AProjectChartedCharacter::DoLook(float Yaw, float Pitch)
+{
+    if (!Controller) return;
+
+    AddControllerYawInput(Yaw);
+    AddControllerPitchInput(Pitch);
+}
+
+void AProjectChartedCharacter::DoJumpStart()
+{
+    Jump();
+}
+
+void AProjectChartedCharacter::DoJumpEnd()
+{
+    StopJumping();
+}
 
-    PlayerInputComponent->BindAction("ToggleShoulder", IE_Pressed, this, &AProjectChartedCharacter::ToggleShoulder);
+void AProjectChartedCharacter::DoToggleShoulder()
+{
+    if (IsAiming()) // Ne change d'épaule que si on vise
+    {
+        SetRightShoulder(!CameraRig->IsRightShoulder());
+    }
 }
 
-// --- Rplication ---
+// --- Réplication ---
 void AProjectChartedCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-    DOREPLIFETIME(AProjectChartedCharacter, CurrentWeapon);
+
+    // Push model : comparé uniquement quand SetCurrentWeapon le marque modifié
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+    DOREPLIFETIME_WITH_PARAMS_FAST(AProjectChartedCharacter, CurrentWeapon, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(AProjectChartedCharacter, CurrentHP, Params);
+
+    // Le propriétaire connaît déjà sa visée
+    FDoRepLifetimeParams AimParams;
+    AimParams.bIsPushBased = true;
+    AimParams.Condition = COND_SkipOwner;
+    DOREPLIFETIME_WITH_PARAMS_FAST(AProjectChartedCharacter, ReplicatedAim, AimParams);
+}
+
+void AProjectChartedCharacter::UpdateReplicatedAim()
+{
+    const double Now = GetWorld()->GetTimeSeconds();
+    const double Elapsed = Now - LastAimUpdateTime;
+    if (Elapsed < AimUpdateMinInterval) return;
+
+    const FRotator AimRotation = Controller ? Controller->GetControlRotation() : GetActorRotation();
+    const bool bAiming = IsAiming();
+    const bool bRightShoulder = IsRightShoulder();
+
+    // Intervalle adaptatif : minimal pour un changement d'état ou une rotation rapide, maximal quand la visée est stable
+    float Interval = AimUpdateMinInterval;
+    if (bAiming == ReplicatedAim.bAiming && bRightShoulder == ReplicatedAim.bRightShoulder)
+    {
+        const FRotator Delta = (AimRotation - ReplicatedAim.GetRotation()).GetNormalized();
+        const float Angle = FMath::Max(FMath::Abs(Delta.Pitch), FMath::Abs(Delta.Yaw));
+        const float Alpha = AimFastUpdateAngle > 0.f ? FMath::Clamp(Angle / AimFastUpdateAngle, 0.f, 1.f) : 1.f;
+        Interval = FMath::Lerp(AimUpdateMaxInterval, AimUpdateMinInterval, Alpha);
+    }
+    if (Elapsed < Interval) return;
+
+    FReplicatedAim NewAim;
+    NewAim.SetRotation(AimRotation);
+    NewAim.bAiming = bAiming;
+    NewAim.bRightShoulder = bRightShoulder;
+    LastAimUpdateTime = Now;
+
+    // Valeur quantifiée inchangée : rien à envoyer
+    if (NewAim == ReplicatedAim) return;
+
+    ReplicatedAim = NewAim;
+    MARK_PROPERTY_DIRTY_FROM_NAME(AProjectChartedCharacter, ReplicatedAim, this);
+    NET_BANDWIDTH_RECORD_PROPERTY(AProjectChartedCharacter, ReplicatedAim, this);
+}
+
+FRotator AProjectChartedCharacter::GetAimRotation() const
+{
+    if (GetLocalRole() == ROLE_SimulatedProxy)
+    {
+        return DisplayedAimRotation;
+    }
+    return Controller ? Controller->GetControlRotation() : GetBaseAimRotation();
+}
+
+void AProjectChartedCharacter::SetCurrentWeapon(AWeapon* NewWeapon)
+{
+    // Les confirmations de tir suivent l'arme tenue
+    if (CurrentWeapon)
+    {
+        CurrentWeapon->OnShotHit.Remove(ShotHitHandle);
+        ShotHitHandle.Reset();
+    }
+    if (NewWeapon)
+    {
+        ShotHitHandle = NewWeapon->OnShotHit.AddUObject(this, &AProjectChartedCharacter::HandleShotHit);
+    }
+
+    CurrentWeapon = NewWeapon;
+    MARK_PROPERTY_DIRTY_FROM_NAME(AProjectChartedCharacter, CurrentWeapon, this);
+    NET_BANDWIDTH_RECORD_PROPERTY(AProjectChartedCharacter, CurrentWeapon, this);
 }
 
 // --- Equipement d'une arme ---
@@ -182,19 +408,21 @@ void AProjectChartedCharacter::EquipWeapon(TSubclassOf<AWeapon> WeaponClass)
 {
     if (!HasAuthority() || !WeaponClass) return;
 
-    // Dtruire l'arme actuelle si besoin
+    // Déjà équipée : rien à faire
+    if (CurrentWeapon && CurrentWeapon->GetClass() == WeaponClass) return;
+
+    UWeaponPoolSubsystem* WeaponPool = GetWorld()->GetSubsystem<UWeaponPoolSubsystem>();
+    if (!WeaponPool) return;
+
+    // Ranger l'arme actuelle dans le pool au lieu de la détruire
     if (CurrentWeapon)
     {
-        CurrentWeapon->Destroy();
-        CurrentWeapon = nullptr;
+        WeaponPool->ReleaseWeapon(CurrentWeapon);
+        SetCurrentWeapon(nullptr);
     }
 
-    // Spawn la nouvelle arme
-    FActorSpawnParameters SpawnParams;
-    SpawnParams.Owner = this;
-    SpawnParams.Instigator = this;
-    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-    CurrentWeapon = GetWorld()->SpawnActor<AWeapon>(WeaponClass, FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+    // Réutiliser une arme existante (ou en créer une si le pool est vide)
+    SetCurrentWeapon(WeaponPool->AcquireWeapon(WeaponClass, this));
     if (CurrentWeapon)
     {
         AttachWeaponToSocket();
@@ -211,159 +439,410 @@ void AProjectChartedCharacter::AttachWeaponToSocket()
 
 void AProjectChartedCharacter::OnRep_CurrentWeapon()
 {
+    // Le mouvement de l'arme n'est pas répliqué : l'attache est déduite de CurrentWeapon
     AttachWeaponToSocket();
+
+    // Le serveur remet le compteur à zéro à chaque changement de main (AWeapon::ActivateForOwner)
+    if (CurrentWeapon && IsLocallyControlled())
+    {
+        CurrentWeapon->SetShotCounter(0);
+    }
 }
 
 // --- Input Fire ---
-void AProjectChartedCharacter::OnFire()
+void AProjectChartedCharacter::DoFireStart()
 {
-    if (CurrentWeapon)
-    {
-        CurrentWeapon->Fire();
-    }
+    // Le tir lui-même est émis par ProcessFireSchedule, à l'instant exact de l'appui
+    FireScheduler.Press(GetWorld()->GetTimeSeconds());
 }
 
-void AProjectChartedCharacter::OnAimPressed()
+void AProjectChartedCharacter::DoFireEnd()
 {
-    bIsAiming = true;
-    GetCharacterMovement()->MaxWalkSpeed = 250.f;
+    FireScheduler.Release();
 }
 
-void AProjectChartedCharacter::OnAimReleased()
+void AProjectChartedCharacter::ProcessFireSchedule()
 {
-    bIsAiming = false;
-    GetCharacterMovement()->MaxWalkSpeed = 500.f;
-    bIsRightShoulder = true; // Revient  l'paule droite
+    if (!CurrentWeapon || !IsAlive()) return;
+
+    const FWeaponStats& Stats = CurrentWeapon->GetStats();
+    const double Now = GetWorld()->GetTimeSeconds();
+    double FirstShotTime = Now;
+    int32 NumShots = FireScheduler.Advance(Now, Stats.GetFireInterval(), Stats.bAutomatic, FirstShotTime);
+    if (NumShots <= 0) return;
+
+    // La salve s'arrête au dernier tir du chargeur : le suivant part après le rechargement
+    const int32 FirstShotIndex = CurrentWeapon->GetShotCounter();
+    const int32 RoundsInMagazine = CurrentWeapon->GetRoundsInMagazine();
+    if (NumShots >= RoundsInMagazine)
+    {
+        NumShots = RoundsInMagazine;
+        FireScheduler.Delay(FirstShotTime + (NumShots - 1) * Stats.GetFireInterval() + Stats.ReloadTime);
+        OnReloadStarted(Stats.ReloadTime);
+    }
+    if (HasAuthority())
+    {
+        CurrentWeapon->FireShots(NumShots, float(Now - FirstShotTime));
+    }
+    else
+    {
+        // Le client avance son compteur prédit et envoie la salve entière en un seul RPC,
+        // avec l'instant du premier tir exprimé dans l'horloge du serveur
+        const AGameStateBase* GameState = GetWorld()->GetGameState();
+        const double ServerClockOffset = GameState ? GameState->GetServerWorldTimeSeconds() - Now : 0.0;
+        const float ServerFirstShotTime = float(FirstShotTime + ServerClockOffset);
+        ServerFire(ServerFirstShotTime, FirstShotIndex, uint8(NumShots));
+        NET_BANDWIDTH_RECORD_RPC(AProjectChartedCharacter, ServerFire, this, ServerFirstShotTime, FirstShotIndex, uint8(NumShots));
+        CurrentWeapon->SetShotCounter(FirstShotIndex + NumShots);
+    }
+
+    // Retour visuel réservé aux joueurs : les bots d'un serveur dédié n'en ont pas besoin
+    if (IsPlayerControlled() && GetNetMode() != NM_DedicatedServer)
+    {
+        PredictShots(FirstShotIndex, NumShots);
+    }
+
+    for (int32 i = 0; i < NumShots; ++i)
+    {
+        ApplyRecoil(FirstShotIndex + i);
+    }
 }
 
-void AProjectChartedCharacter::UpdateAim(float DeltaTime)
+void AProjectChartedCharacter::PredictShots(int32 FirstShotId, int32 NumShots)
 {
-    if (CameraBoom && RightShoulderCamera && LeftShoulderCamera)
+    const int32 PelletCount = CurrentWeapon->GetStats().FireMode == EWeaponFireMode::Pellets ? CurrentWeapon->GetStats().PelletCount : 1;
+
+    for (int32 ShotId = FirstShotId; ShotId < FirstShotId + NumShots; ++ShotId)
     {
-        float TargetArmLength = bIsAiming ? AimArmLength : DefaultArmLength;
-        float TargetFOV = bIsAiming ? AimFOV : DefaultFOV;
-        FVector TargetOffset;
-        if (bIsRightShoulder)
-        {
-            TargetOffset = bIsAiming ? AimSocketOffset : DefaultSocketOffset;
-        }
-        else
-        {
-            TargetOffset = bIsAiming ? AimSocketOffsetLeft : DefaultSocketOffsetLeft;
-        }
-        CameraBoom->TargetArmLength = FMath::FInterpTo(CameraBoom->TargetArmLength, TargetArmLength, DeltaTime, AimInterpSpeed);
-        FVector Offset = CameraBoom->SocketOffset;
-        Offset.X = FMath::FInterpTo(Offset.X, TargetOffset.X, DeltaTime, AimInterpSpeed);
-        Offset.Y = FMath::FInterpTo(Offset.Y, TargetOffset.Y, DeltaTime, AimInterpSpeed);
-        Offset.Z = FMath::FInterpTo(Offset.Z, TargetOffset.Z, DeltaTime, AimInterpSpeed);
-        CameraBoom->SocketOffset = Offset;
-
-        // Active la bonne camra
-        if (bIsRightShoulder)
-        {
-            RightShoulderCamera->SetActive(true);
-            LeftShoulderCamera->SetActive(false);
-            RightShoulderCamera->SetFieldOfView(FMath::FInterpTo(RightShoulderCamera->FieldOfView, TargetFOV, DeltaTime, AimInterpSpeed));
-        }
-        else
+        FPredictedShot& Predicted = PredictedShots[ShotId % MaxPredictedShots];
+        Predicted.ShotId = ShotId;
+        Predicted.bPredictedHit = false;
+
+        for (int32 Pellet = 0; Pellet < PelletCount; ++Pellet)
         {
-            RightShoulderCamera->SetActive(false);
-            LeftShoulderCamera->SetActive(true);
-            LeftShoulderCamera->SetFieldOfView(FMath::FInterpTo(LeftShoulderCamera->FieldOfView, TargetFOV, DeltaTime, AimInterpSpeed));
+            FHitResult Hit;
+            const bool bHit = CurrentWeapon->PredictShot(ShotId, Pellet, Hit);
+            Predicted.bPredictedHit |= bHit && Cast<ICombatDamageable>(Hit.GetActor()) != nullptr;
+            OnShotPredicted(ShotId, Hit.ImpactPoint, bHit);
         }
     }
 }
 
+void AProjectChartedCharacter::HandleShotHit(int32 ShotId, const FHitResult& Hit)
+{
+    // Hôte local : pas de RPC nécessaire
+    if (IsLocallyControlled())
+    {
+        ClientConfirmHit_Implementation(ShotId, Hit.ImpactPoint);
+    }
+    else
+    {
+        ClientConfirmHit(ShotId, Hit.ImpactPoint);
+        NET_BANDWIDTH_RECORD_RPC(AProjectChartedCharacter, ClientConfirmHit, this, ShotId, FVector_NetQuantize(Hit.ImpactPoint));
+    }
+}
+
+void AProjectChartedCharacter::ClientConfirmHit_Implementation(int32 ShotId, FVector_NetQuantize ImpactPoint)
+{
+    const FPredictedShot& Predicted = PredictedShots[ShotId % MaxPredictedShots];
+    OnHitConfirmed(ShotId, ImpactPoint, Predicted.ShotId == ShotId && Predicted.bPredictedHit);
+}
+
+void AProjectChartedCharacter::RejectShots(int32 FirstShotId, uint8 NumShots)
+{
+    const int32 ServerShotCounter = CurrentWeapon ? CurrentWeapon->GetShotCounter() : 0;
+    ClientRejectShots(FirstShotId, NumShots, ServerShotCounter);
+    NET_BANDWIDTH_RECORD_RPC(AProjectChartedCharacter, ClientRejectShots, this, FirstShotId, NumShots, ServerShotCounter);
+}
+
+void AProjectChartedCharacter::ClientRejectShots_Implementation(int32 FirstShotId, uint8 NumShots, int32 ServerShotCounter)
+{
+    // Le compteur prédit ne recule jamais (des salves plus récentes peuvent être en route),
+    // mais il rattrape le serveur s'il est en retard : sinon toutes ses salves seraient refusées
+    if (CurrentWeapon && ServerShotCounter > CurrentWeapon->GetShotCounter())
+    {
+        CurrentWeapon->SetShotCounter(ServerShotCounter);
+    }
+    OnShotsRejected(FirstShotId, NumShots);
+}
+
+void AProjectChartedCharacter::ApplyRecoil(int32 ShotIndex)
+{
+    if (Controller && CurrentWeapon)
+    {
+        Controller->SetControlRotation(Controller->GetControlRotation() + CurrentWeapon->GetRecoilKick(ShotIndex));
+    }
+}
+
+void AProjectChartedCharacter::ServerFire_Implementation(float ClientFireTime, int32 ShotCounter, uint8 NumShots)
+{
+    NET_BANDWIDTH_RECORD_RPC(AProjectChartedCharacter, ServerFire, this, ClientFireTime, ShotCounter, NumShots);
+
+    if (!CurrentWeapon || !IsAlive() || NumShots == 0 || NumShots > FWeaponFireScheduler::MaxShotsPerAdvance) return;
+
+    // Doublon, paquet en retard ou compteur client en retard sur le serveur : refus, le client se recale
+    const int32 ServerShotCounter = CurrentWeapon->GetShotCounter();
+    if (ShotCounter < ServerShotCounter)
+    {
+        RejectShots(ShotCounter, NumShots);
+        return;
+    }
+
+    // Les tirs sautés (RPC perdus) consomment le crédit restant : le client ne peut pas choisir ses indices de dispersion
+    // à pleine cadence. La cadence est vérifiée en temps serveur, l'horodatage du client n'y intervient pas
+    const int64 SkippedShots = int64(ShotCounter) - ServerShotCounter;
+    if (!CurrentWeapon->CanFireClientShots(ShotCounter, NumShots) || !CurrentWeapon->ConsumeFireCredit(NumShots, SkippedShots))
+    {
+        RejectShots(ShotCounter, NumShots);
+        return;
+    }
+
+    // Se recaler sur le compteur du client (les RPC perdus ne désynchronisent pas la dispersion)
+    CurrentWeapon->SetShotCounter(ShotCounter);
+
+    // Âge du premier tir : latence aller et délai dans la frame du client, borné comme le rembobinage.
+    // Les projectiles sont avancés d'autant ; les tirs hitscan rembobinent les autres personnages
+    const float FirstShotAge = FMath::Clamp(float(GetWorld()->GetTimeSeconds() - ClientFireTime), 0.f, MaxLagCompensationTime);
+    CurrentWeapon->FireShots(NumShots, FirstShotAge, GetLagCompensatedTime());
+}
+
+void AProjectChartedCharacter::DoAimStart()
+{
+    // La vitesse de visée est appliquée par le composant de mouvement, côté client comme serveur
+    GetCharacterMovement<UProjectChartedMovementComponent>()->SetWantsToAim(true);
+    CameraRig->SetAiming(true);
+}
+
+bool AProjectChartedCharacter::IsAiming() const
+{
+    if (GetLocalRole() == ROLE_SimulatedProxy)
+    {
+        return ReplicatedAim.bAiming;
+    }
+    const UProjectChartedMovementComponent* Movement = GetCharacterMovement<UProjectChartedMovementComponent>();
+    return Movement && Movement->IsAiming();
+}
+
+void AProjectChartedCharacter::DoAimEnd()
+{
+    GetCharacterMovement<UProjectChartedMovementComponent>()->SetWantsToAim(false);
+    CameraRig->SetAiming(false);
+    SetRightShoulder(true); // Revient à l'épaule droite
+}
+
+bool AProjectChartedCharacter::IsRightShoulder() const
+{
+    if (GetLocalRole() == ROLE_SimulatedProxy)
+    {
+        return ReplicatedAim.bRightShoulder;
+    }
+    return HasAuthority() ? bServerRightShoulder : CameraRig->IsRightShoulder();
+}
+
+void AProjectChartedCharacter::SetRightShoulder(bool bRightShoulder)
+{
+    if (CameraRig->IsRightShoulder() == bRightShoulder) return;
+
+    CameraRig->SetRightShoulder(bRightShoulder);
+    if (HasAuthority())
+    {
+        bServerRightShoulder = bRightShoulder;
+    }
+    else
+    {
+        ServerSetRightShoulder(bRightShoulder);
+        NET_BANDWIDTH_RECORD_RPC(AProjectChartedCharacter, ServerSetRightShoulder, this, bRightShoulder);
+    }
+}
+
+void AProjectChartedCharacter::ServerSetRightShoulder_Implementation(bool bRightShoulder)
+{
+    NET_BANDWIDTH_RECORD_RPC(AProjectChartedCharacter, ServerSetRightShoulder, this, bRightShoulder);
+    bServerRightShoulder = bRightShoulder;
+}
+
 // --- Bonus : Ramasser une arme au sol ---
 void AProjectChartedCharacter::ServerPickupWeapon_Implementation(AActor* WeaponActor)
 {
-    if (!HasAuthority() || !WeaponActor) return;
-    AWeapon* PickupWeapon = Cast<AWeapon>(WeaponActor);
-    if (PickupWeapon)
+    if (!HasAuthority()) return;
+
+    // Reçu d'un client distant : compté ici aussi pour le budget par joueur du serveur (l'hôte local n'envoie rien)
+    if (!IsLocallyControlled())
     {
-        // Dtruire l'arme actuelle
+        NET_BANDWIDTH_RECORD_RPC(AProjectChartedCharacter, ServerPickupWeapon, this, static_cast<const UObject*>(WeaponActor));
+    }
+
+    UWeaponPickupSubsystem* Pickups = GetWorld()->GetSubsystem<UWeaponPickupSubsystem>();
+    if (!Pickups) return;
+
+    // La position vient du serveur : une arme non indexée ou hors de portée est refusée
+    const FVector Location = GetActorLocation();
+    AWeapon* PickupWeapon = WeaponActor ? Cast<AWeapon>(WeaponActor) : Pickups->FindNearestPickup(Location, PickupReach);
+    if (!PickupWeapon || !Pickups->IsPickupInReach(PickupWeapon, Location, PickupReach)) return;
+
+    if (PickupWeapon != CurrentWeapon)
+    {
+        UWeaponPoolSubsystem* WeaponPool = GetWorld()->GetSubsystem<UWeaponPoolSubsystem>();
+
+        // Ranger l'arme actuelle dans le pool
         if (CurrentWeapon)
         {
-            CurrentWeapon->Destroy();
-            CurrentWeapon = nullptr;
+            if (WeaponPool)
+            {
+                WeaponPool->ReleaseWeapon(CurrentWeapon);
+            }
+            else
+            {
+                CurrentWeapon->Destroy();
+            }
+            SetCurrentWeapon(nullptr);
         }
-        // Attacher l'arme ramasse
-        CurrentWeapon = PickupWeapon;
+
+        // Attacher l'arme ramassée
+        if (WeaponPool)
+        {
+            WeaponPool->RemoveFromPool(PickupWeapon);
+        }
+        PickupWeapon->ActivateForOwner(this);
+        SetCurrentWeapon(PickupWeapon);
         AttachWeaponToSocket();
-        // Dsactiver la collision pour viter de la ramasser  nouveau
+        // Désactiver la collision pour éviter de la ramasser à nouveau
         PickupWeapon->SetActorEnableCollision(false);
     }
 }
+// Une demande hors de portée peut venir d'un client légitime en retard : elle est ignorée, pas sanctionnée
 bool AProjectChartedCharacter::ServerPickupWeapon_Validate(AActor* WeaponActor) { return true; }
 
-void AProjectChartedCharacter::MoveForward(float Value)
+void AProjectChartedCharacter::PickupNearestWeapon()
 {
-    if (Controller && Value != 0.0f)
+    ServerPickupWeapon(nullptr);
+    if (!HasAuthority())
     {
-        const FRotator YawRotation(0, Controller->GetControlRotation().Yaw, 0);
-        const FVector Direction = FRotationMatrix(YawRotation).GetUnitAxis(EAxis::X);
-        AddMovementInput(Direction, Value);
+        NET_BANDWIDTH_RECORD_RPC(AProjectChartedCharacter, ServerPickupWeapon, this, static_cast<const UObject*>(nullptr));
     }
 }
 
-void AProjectChartedCharacter::MoveRight(float Value)
+// --- Compensation de latence ---
+void AProjectChartedCharacter::RecordPose()
 {
-    if (Controller && Value != 0.0f)
+    const UCapsuleComponent* Capsule = GetCapsuleComponent();
+
+    FPoseSnapshot Snapshot;
+    Snapshot.Time = GetWorld()->GetTimeSeconds();
+    Snapshot.CapsuleCenter = FVector3f(Capsule->GetComponentLocation());
+    Snapshot.CapsuleRadius = Capsule->GetScaledCapsuleRadius();
+    Snapshot.CapsuleHalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+    Snapshot.HeadCenter = FVector3f(GetMesh()->DoesSocketExist(HeadBoneName)
+        ? GetMesh()->GetSocketLocation(HeadBoneName)
+        : Capsule->GetComponentLocation() + FVector(0.f, 0.f, Snapshot.CapsuleHalfHeight - HeadHitRadius));
+    PoseHistory.Record(Snapshot);
+}
+
+double AProjectChartedCharacter::GetLagCompensatedTime() const
+{
+    // Le client voit les autres joueurs avec environ une demi-latence de retard
+    const APlayerState* PS = GetPlayerState();
+    const double HalfPing = PS ? PS->GetPingInMilliseconds() * 0.0005 : 0.0;
+    return GetWorld()->GetTimeSeconds() - FMath::Min(HalfPing, double(MaxLagCompensationTime));
+}
+
+bool AProjectChartedCharacter::WasHitAtTime(double Time, const FVector& Start, const FVector& End, FVector& OutImpactPoint) const
+{
+    FPoseSnapshot Pose;
+    if (!PoseHistory.Sample(Time, Pose))
     {
-        const FRotator YawRotation(0, Controller->GetControlRotation().Yaw, 0);
-        const FVector Direction = FRotationMatrix(YawRotation).GetUnitAxis(EAxis::Y);
-        AddMovementInput(Direction, Value);
+        return false;
     }
+    return LagCompensation::SegmentHitsPose(Pose, Start, End, HeadHitRadius, HitValidationTolerance, OutImpactPoint);
 }
 
-void AProjectChartedCharacter::Turn(float Value)
+// --- Points de vie ---
+void AProjectChartedCharacter::SetCurrentHP(float NewHP)
 {
-    AddControllerYawInput(Value);
+    CurrentHP = NewHP;
+    MARK_PROPERTY_DIRTY_FROM_NAME(AProjectChartedCharacter, CurrentHP, this);
+    NET_BANDWIDTH_RECORD_PROPERTY(AProjectChartedCharacter, CurrentHP, this);
 }
 
-void AProjectChartedCharacter::LookUp(float Value)
+void AProjectChartedCharacter::ApplyDamage(float Damage, AActor* DamageCauser, const FVector& DamageLocation, const FVector& DamageImpulse)
 {
-    AddControllerPitchInput(-Value); // Inversion de l'axe Y pour la souris
+    FDamageEvent DamageEvent;
+    const float ActualDamage = TakeDamage(Damage, DamageEvent, DamageCauser ? DamageCauser->GetInstigatorController() : nullptr, DamageCauser);
+    if (ActualDamage > 0.f)
+    {
+        GetCharacterMovement()->AddImpulse(DamageImpulse, true);
+        OnDamageReceived(ActualDamage, DamageLocation, DamageImpulse.GetSafeNormal());
+    }
 }
 
-void AProjectChartedCharacter::StartJump()
+float AProjectChartedCharacter::TakeDamage(float Damage, FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser)
 {
-    Jump();
+    // Seul le serveur décide ; un personnage mort ne reçoit plus de dégâts
+    if (!HasAuthority() || !IsAlive()) return 0.f;
+
+    const float ActualDamage = Super::TakeDamage(Damage, DamageEvent, EventInstigator, DamageCauser);
+    if (ActualDamage <= 0.f) return 0.f;
+
+    SetCurrentHP(FMath::Max(CurrentHP - ActualDamage, 0.f));
+    if (!IsAlive())
+    {
+        HandleDeath();
+    }
+    return ActualDamage;
 }
 
-void AProjectChartedCharacter::StopJump()
+void AProjectChartedCharacter::HandleDeath()
 {
-    StopJumping();
+    PlayDeath();
+    GetWorldTimerManager().SetTimer(RespawnTimer, this, &AProjectChartedCharacter::RespawnCharacter, RespawnTime, false);
 }
 
-void AProjectChartedCharacter::StartAiming()
+void AProjectChartedCharacter::ApplyHealing(float Healing, AActor* Healer)
 {
-    bIsAiming = true;
+    if (HasAuthority() && IsAlive() && Healing > 0.f)
+    {
+        SetCurrentHP(FMath::Min(CurrentHP + Healing, MaxHP));
+    }
 }
 
-void AProjectChartedCharacter::StopAiming()
+void AProjectChartedCharacter::OnRep_CurrentHP(float OldHP)
 {
-    bIsAiming = false;
+    if (OldHP > 0.f && !IsAlive())
+    {
+        PlayDeath();
+    }
 }
 
-void AProjectChartedCharacter::UpdateCameraShoulder(float DeltaTime)
+void AProjectChartedCharacter::PlayDeath()
 {
-    if (CameraBoom)
+    FireScheduler.Release();
+    GetCharacterMovement()->DisableMovement();
+
+    // Ragdoll seulement si le mesh est chargé (serveur dédié compris)
+    if (GetMesh()->GetSkeletalMeshAsset())
     {
-        FVector TargetOffset = bIsAiming ? ShoulderCameraOffset : DefaultCameraOffset;
-        FVector CurrentOffset = CameraBoom->SocketOffset;
-        FVector NewOffset;
-        NewOffset.X = FMath::FInterpTo(CurrentOffset.X, TargetOffset.X, DeltaTime, CameraLerpSpeed);
-        NewOffset.Y = FMath::FInterpTo(CurrentOffset.Y, TargetOffset.Y, DeltaTime, CameraLerpSpeed);
-        NewOffset.Z = FMath::FInterpTo(CurrentOffset.Z, TargetOffset.Z, DeltaTime, CameraLerpSpeed);
-        CameraBoom->SocketOffset = NewOffset;
+        GetMesh()->SetCollisionProfileName(TEXT("Ragdoll"));
+        GetMesh()->SetSimulatePhysics(true);
     }
+    OnDied();
 }
 
-void AProjectChartedCharacter::ToggleShoulder()
+void AProjectChartedCharacter::RespawnCharacter()
 {
-    if (bIsAiming) // Ne change d'paule que si on vise
+    AController* OwningController = GetController();
+    AGameModeBase* GameMode = GetWorld()->GetAuthGameMode();
+
+    // Dépossession d'abord : détruire un pawn possédé appelle PawnPendingDestroy, qui détruit aussi
+    // un contrôleur sans PlayerState (bots du mode soak) ; le contrôleur doit survivre pour réapparaître
+    if (OwningController)
+    {
+        OwningController->UnPossess();
+    }
+
+    // Le pawn détruit rend son arme au pool (EndPlay) ; le mode de jeu en fait apparaître un neuf
+    Destroy();
+    if (GameMode && OwningController)
     {
-        bIsRightShoulder = !bIsRightShoulder;
+        GameMode->RestartPlayer(OwningController);
     }
 }
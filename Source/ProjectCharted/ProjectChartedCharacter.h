@@ -5,40 +5,95 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
 #include "Weapon.h"
+#include "LagCompensation.h"
+#include "WeaponFireScheduler.h"
+#include "Engine/StreamableManager.h"
 #include "Net/UnrealNetwork.h"
 #include "Camera/CameraComponent.h"
 #include "GameFramework/SpringArmComponent.h"
+#include "CameraRigComponent.h"
+#include "ReplicatedAim.h"
+#include "CombatDamageable.h"
+#include "CharacterDefinition.h"
 #include "ProjectChartedCharacter.generated.h"
 
+class UAnimInstance;
+class UInputAction;
+struct FInputActionValue;
+
 /**
- * Personnage jouable C++ visible et slectionnable dans l'diteur Unreal Engine.
+ * Personnage jouable C++ visible et sélectionnable dans l'éditeur Unreal Engine.
  */
 UCLASS()
-class PROJECTCHARTED_API AProjectChartedCharacter : public ACharacter
+class PROJECTCHARTED_API AProjectChartedCharacter : public ACharacter, public ICombatDamageable
 {
     GENERATED_BODY()
 
 public:
-    AProjectChartedCharacter();
+    AProjectChartedCharacter(const FObjectInitializer& ObjectInitializer);
 
-    // Arme actuellement quipe (rplique)
+    // Arme actuellement équipée (répliquée)
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, ReplicatedUsing=OnRep_CurrentWeapon, Category="Weapon")
     AWeapon* CurrentWeapon = nullptr;
 
-    // Camera boom (bras de camra)
+    // Camera boom (bras de caméra)
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Camera)
     USpringArmComponent* CameraBoom;
 
-    // Camra de suivi (paule droite)
+    // Caméra de suivi unique (le côté d'épaule est géré par le rig)
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Camera)
-    UCameraComponent* RightShoulderCamera;
+    UCameraComponent* FollowCamera;
 
-    // Camra paule gauche
+    // Rig qui pilote le bras et la caméra (visée, épaule)
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Camera)
-    UCameraComponent* LeftShoulderCamera;
+    UCameraRigComponent* CameraRig;
 
 protected:
+    // --- Entrées (Enhanced Input) ---
+    // Actions assignées dans le Blueprint du personnage ; les contextes de mapping sont ajoutés par le PlayerController.
+    // Laissées vides (personnage natif) : actions de /Game/Input/Actions, et actions d'arme d'AProjectChartedPlayerController
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
+    UInputAction* MoveAction = nullptr;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
+    UInputAction* LookAction = nullptr;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
+    UInputAction* MouseLookAction = nullptr;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
+    UInputAction* JumpAction = nullptr;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
+    UInputAction* AimAction = nullptr;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
+    UInputAction* FireAction = nullptr;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
+    UInputAction* ToggleShoulderAction = nullptr;
+
+    // Apparence du personnage (bundle "Game", préchargé par l'état de jeu) ; si absente, CharacterMesh et CharacterAnimClass
+    UPROPERTY(EditDefaultsOnly, Category = "Mesh")
+    TObjectPtr<UCharacterDefinition> Definition;
+
+    // Mesh du personnage, chargé de façon asynchrone au BeginPlay (aucune référence dure dans le CDO)
+    UPROPERTY(EditDefaultsOnly, Category = "Mesh")
+    TSoftObjectPtr<USkeletalMesh> CharacterMesh;
+
+    // Blueprint d'animation, chargé avec le mesh
+    UPROPERTY(EditDefaultsOnly, Category = "Mesh")
+    TSoftClassPtr<UAnimInstance> CharacterAnimClass;
+
+    // Mesh et animation de la définition s'il y en a une, sinon les valeurs par défaut
+    const TSoftObjectPtr<USkeletalMesh>& GetMeshToLoad() const;
+    const TSoftClassPtr<UAnimInstance>& GetAnimClassToLoad() const;
+
+    TSharedPtr<FStreamableHandle> MeshLoadHandle;
+    void OnCharacterAssetsLoaded();
+
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
     virtual void Tick(float DeltaTime) override;
 
@@ -46,63 +101,256 @@ protected:
     void OnRep_CurrentWeapon();
 
     void AttachWeaponToSocket();
+
+    // Change l'arme côté serveur et la marque modifiée pour la réplication (push model)
+    void SetCurrentWeapon(AWeapon* NewWeapon);
     virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
-    void OnFire();
-
-    // --- ADS (Aim Down Sight) ---
-    void OnAimPressed();
-    void OnAimReleased();
-    void UpdateAim(float DeltaTime);
-    bool bIsAiming = false;
-    float DefaultFOV = 90.f;
-    float AimFOV = 58.f;
-    float AimInterpSpeed = 10.f;
-    float DefaultArmLength = 350.f;
-    float AimArmLength = 160.f;
-    FVector DefaultSocketOffset = FVector(0.f, 120.f, 60.f); // paule droite
-    FVector AimSocketOffset = FVector(50.f, 150.f, 68.f);   // vise trs  droite
-    // Offsets inspirs d'Uncharted 2 multi pour paule gauche
-    FVector DefaultSocketOffsetLeft = FVector(30.f, -75.f, 75.f); // paule gauche, bien dcale et surleve
-    FVector AimSocketOffsetLeft = FVector(50.f, -80.f, 80.f);     // vise paule gauche, plus proche et haute
-
-    // Camra paule
-    FVector DefaultCameraOffset = FVector(0.f, 0.f, 60.f); // Centr derrire le personnage
-    FVector ShoulderCameraOffset = FVector(50.f, 60.f, 60.f);
-    float CameraLerpSpeed = 10.f;
-    void StartAiming();
-    void StopAiming();
-    void UpdateCameraShoulder(float DeltaTime);
-
-    void MoveForward(float Value);
-    void MoveRight(float Value);
-    void Turn(float Value);
-    void LookUp(float Value);
-
-    // Saut
-    void StartJump();
-    void StopJump();
-
-    // Changement d'paule
-    bool bIsRightShoulder = true;
-    void ToggleShoulder();
+
+    // Axes 2D déclenchés seulement quand ils sont actionnés, puis routés vers DoMove / DoLook
+    void Move(const FInputActionValue& Value);
+    void Look(const FInputActionValue& Value);
+
+    // Cadence de tir à instants exacts (joueur local uniquement)
+    FWeaponFireScheduler FireScheduler;
+
+    // Émet en un seul lot tous les tirs dus depuis la frame précédente
+    void ProcessFireSchedule();
+
+    // Applique localement le recul déterministe du tir ShotIndex
+    void ApplyRecoil(int32 ShotIndex);
+
+    // --- Prédiction des tirs ---
+    // Tir prédit localement, en attente de confirmation du serveur
+    struct FPredictedShot
+    {
+        int32 ShotId = INDEX_NONE;
+        bool bPredictedHit = false;
+    };
+
+    // Historique circulaire des tirs prédits, indexé par ShotId
+    static constexpr int32 MaxPredictedShots = 64;
+    FPredictedShot PredictedShots[MaxPredictedShots];
+
+    // Retour visuel immédiat d'une salve (traces cosmétiques locales)
+    void PredictShots(int32 FirstShotId, int32 NumShots);
+
+    // Serveur : refuse une salve et transmet le compteur du serveur pour que le client s'y recale
+    void RejectShots(int32 FirstShotId, uint8 NumShots);
+
+    // Serveur : tir de l'arme actuelle ayant infligé des dégâts
+    void HandleShotHit(int32 ShotId, const FHitResult& Hit);
+    FDelegateHandle ShotHitHandle;
+
+    // Effets de tir prédits (bouche du canon, impact) joués sans attendre le serveur
+    UFUNCTION(BlueprintImplementableEvent, Category = "Weapon")
+    void OnShotPredicted(int32 ShotId, const FVector& ImpactPoint, bool bHitSomething);
+
+    // Le serveur a confirmé que le tir a touché ; bWasPredicted indique si le client l'avait anticipé
+    UFUNCTION(BlueprintImplementableEvent, Category = "Weapon")
+    void OnHitConfirmed(int32 ShotId, const FVector& ImpactPoint, bool bWasPredicted);
+
+    // Dernier tir du chargeur parti localement : le rechargement dure ReloadTime
+    UFUNCTION(BlueprintImplementableEvent, Category = "Weapon")
+    void OnReloadStarted(float ReloadTime);
+
+    // Le serveur a refusé une salve : annuler les effets prédits correspondants
+    UFUNCTION(BlueprintImplementableEvent, Category = "Weapon")
+    void OnShotsRejected(int32 FirstShotId, int32 NumShots);
+
+    // Change d'épaule localement et en informe le serveur (la visée répliquée la diffuse aux autres)
+    void SetRightShoulder(bool bRightShoulder);
+
+    UFUNCTION(Server, Reliable)
+    void ServerSetRightShoulder(bool bRightShoulder);
+
+    // --- Visée répliquée ---
+    // Visée vue par les autres joueurs, écrite par le serveur à fréquence adaptative
+    UPROPERTY(Replicated)
+    FReplicatedAim ReplicatedAim;
+
+    // Serveur : requantifie la visée et ne la marque modifiée qu'à la fréquence voulue
+    void UpdateReplicatedAim();
+
+    // Intervalle entre deux envois quand la visée tourne vite
+    UPROPERTY(EditDefaultsOnly, Category = "Aim", meta = (ClampMin = 0, Units = "s"))
+    float AimUpdateMinInterval = 1.f / 30.f;
+
+    // Intervalle entre deux envois quand la visée bouge à peine
+    UPROPERTY(EditDefaultsOnly, Category = "Aim", meta = (ClampMin = 0, Units = "s"))
+    float AimUpdateMaxInterval = 0.25f;
+
+    // Écart angulaire à partir duquel la visée est envoyée à l'intervalle minimal
+    UPROPERTY(EditDefaultsOnly, Category = "Aim", meta = (ClampMin = 0, Units = "deg"))
+    float AimFastUpdateAngle = 3.f;
+
+    // Vitesse de lissage de la visée affichée sur les proxies simulés
+    UPROPERTY(EditDefaultsOnly, Category = "Aim", meta = (ClampMin = 0))
+    float AimInterpSpeed = 15.f;
+
+    double LastAimUpdateTime = -1.0;
+
+    // Visée lissée des proxies simulés
+    FRotator DisplayedAimRotation = FRotator::ZeroRotator;
+
+    // Épaule choisie par le client propriétaire, connue du serveur
+    bool bServerRightShoulder = true;
+
+    // --- Compensation de latence ---
+    // Historique des poses enregistré côté serveur à chaque tick
+    FPoseHistory PoseHistory;
+    void RecordPose();
+
+    // Os utilisé pour la hitbox de la tête
+    UPROPERTY(EditDefaultsOnly, Category = "Lag Compensation")
+    FName HeadBoneName = TEXT("head");
+
+    // Rayon de la hitbox de la tête
+    UPROPERTY(EditDefaultsOnly, Category = "Lag Compensation", meta = (ClampMin = 0, Units = "cm"))
+    float HeadHitRadius = 15.f;
+
+    // Rembobinage maximal accordé au tireur
+    UPROPERTY(EditDefaultsOnly, Category = "Lag Compensation", meta = (ClampMin = 0, ClampMax = 1, Units = "s"))
+    float MaxLagCompensationTime = 0.25f;
+
+    // Marge acceptée pour la quantification réseau et l'interpolation
+    UPROPERTY(EditDefaultsOnly, Category = "Lag Compensation", meta = (ClampMin = 0, Units = "cm"))
+    float HitValidationTolerance = 10.f;
+
+    // --- Points de vie ---
+    UPROPERTY(EditDefaultsOnly, Category = "Damage", meta = (ClampMin = 1))
+    float MaxHP = 100.f;
+
+    // Points de vie restants, décidés par le serveur (push model)
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, ReplicatedUsing = OnRep_CurrentHP, Category = "Damage")
+    float CurrentHP = 0.f;
+
+    // Délai entre la mort et la réapparition par le mode de jeu
+    UPROPERTY(EditDefaultsOnly, Category = "Damage", meta = (ClampMin = 0, ClampMax = 10, Units = "s"))
+    float RespawnTime = 3.f;
+
+    FTimerHandle RespawnTimer;
+
+    UFUNCTION()
+    void OnRep_CurrentHP(float OldHP);
+
+    // Change les points de vie côté serveur et les marque modifiés pour la réplication
+    void SetCurrentHP(float NewHP);
+
+    // Ragdoll et arrêt du mouvement, joués sur le serveur et sur chaque client
+    void PlayDeath();
+
+    // Détruit le personnage et demande au mode de jeu d'en faire réapparaître un pour son contrôleur
+    void RespawnCharacter();
+
+    // Dégâts reçus (effets, interface)
+    UFUNCTION(BlueprintImplementableEvent, Category = "Damage")
+    void OnDamageReceived(float Damage, const FVector& DamageLocation, const FVector& DamageDirection);
+
+    // Mort du personnage (effets, interface)
+    UFUNCTION(BlueprintImplementableEvent, Category = "Damage")
+    void OnDied();
+
+    virtual float TakeDamage(float Damage, struct FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser) override;
+
+    // Distance maximale de ramassage d'une arme au sol (bornée par la cellule de UWeaponPickupSubsystem)
+    UPROPERTY(EditDefaultsOnly, Category = "Weapon", meta = (ClampMin = 0, ClampMax = 500, Units = "cm"))
+    float PickupReach = 200.f;
 
 public:
 
-    // Fonction pour quiper une arme
+    // Rotation de visée : contrôleur pour le joueur local et le serveur, visée répliquée lissée pour les autres
+    UFUNCTION(BlueprintPure, Category = "Aim")
+    FRotator GetAimRotation() const;
+
+    // Visée prédite par le composant de mouvement (connue du serveur via les mouvements sauvegardés),
+    // visée répliquée pour les proxies simulés
+    UFUNCTION(BlueprintPure, Category = "Aim")
+    bool IsAiming() const;
+
+    UFUNCTION(BlueprintPure, Category = "Aim")
+    bool IsRightShoulder() const;
+
+    // Assets d'apparence à charger pour ce personnage (préchargement depuis le CDO par l'état de jeu)
+    void GetCharacterAssetPaths(TArray<FSoftObjectPath>& OutPaths) const;
+
+    // Fonction pour équiper une arme
     UFUNCTION(BlueprintCallable, Category="Weapon")
     void EquipWeapon(TSubclassOf<AWeapon> WeaponClass);
 
-    // Fonction serveur pour ramasser une arme (bonus)
+    // --- Routage des entrées : manette, clavier, interface ou bots ---
+    UFUNCTION(BlueprintCallable, Category = "Input")
+    virtual void DoMove(float Right, float Forward);
+
+    UFUNCTION(BlueprintCallable, Category = "Input")
+    virtual void DoLook(float Yaw, float Pitch);
+
+    UFUNCTION(BlueprintCallable, Category = "Input")
+    virtual void DoJumpStart();
+
+    UFUNCTION(BlueprintCallable, Category = "Input")
+    virtual void DoJumpEnd();
+
+    // ADS (Aim Down Sight)
+    UFUNCTION(BlueprintCallable, Category = "Input")
+    virtual void DoAimStart();
+
+    UFUNCTION(BlueprintCallable, Category = "Input")
+    virtual void DoAimEnd();
+
+    // Détente pressée / relâchée ; le tir suit la cadence de l'arme
+    UFUNCTION(BlueprintCallable, Category = "Input")
+    virtual void DoFireStart();
+
+    UFUNCTION(BlueprintCallable, Category = "Input")
+    virtual void DoFireEnd();
+
+    // Changement d'épaule (en visée uniquement)
+    UFUNCTION(BlueprintCallable, Category = "Input")
+    virtual void DoToggleShoulder();
+
+    // Salve client -> serveur : seuls l'horodatage du premier tir (horloge du serveur), le compteur et le nombre
+    // de tirs transitent, le serveur recalcule la dispersion à partir de la graine de l'arme
+    UFUNCTION(Server, Unreliable)
+    void ServerFire(float ClientFireTime, int32 ShotCounter, uint8 NumShots);
+
+    // Serveur -> client : impact confirmé pour le tir ShotId
+    UFUNCTION(Client, Unreliable)
+    void ClientConfirmHit(int32 ShotId, FVector_NetQuantize ImpactPoint);
+
+    // Serveur -> client : salve refusée ; ServerShotCounter est le compteur de l'arme côté serveur
+    UFUNCTION(Client, Unreliable)
+    void ClientRejectShots(int32 FirstShotId, uint8 NumShots, int32 ServerShotCounter);
+
+    // Instant serveur vu par ce joueur lors de son tir (temps courant moins sa latence estimée)
+    double GetLagCompensatedTime() const;
+
+    // Vrai si le segment touchait ce personnage à l'instant serveur donné ; OutImpactPoint est le point touché sur le segment
+    bool WasHitAtTime(double Time, const FVector& Start, const FVector& End, FVector& OutImpactPoint) const;
+
+    UFUNCTION(BlueprintPure, Category = "Damage")
+    bool IsAlive() const { return CurrentHP > 0.f; }
+
+    // ICombatDamageable
+    virtual void ApplyDamage(float Damage, AActor* DamageCauser, const FVector& DamageLocation, const FVector& DamageImpulse) override;
+    virtual void HandleDeath() override;
+    virtual void ApplyHealing(float Healing, AActor* Healer) override;
+
+    // Fonction serveur pour ramasser une arme (bonus).
+    // WeaponActor nul : le serveur choisit l'arme au sol la plus proche à portée
     UFUNCTION(Server, Reliable, WithValidation)
     void ServerPickupWeapon(AActor* WeaponActor);
 
+    // Demande au serveur de ramasser l'arme la plus proche (aucune recherche côté client)
+    UFUNCTION(BlueprintCallable, Category = "Weapon")
+    void PickupNearestWeapon();
+
     /** Returns CameraBoom subobject **/
     FORCEINLINE class USpringArmComponent* GetCameraBoom() const { return CameraBoom; }
 
-    /** Returns RightShoulderCamera subobject **/
-    FORCEINLINE class UCameraComponent* GetRightShoulderCamera() const { return RightShoulderCamera; }
-    
-    /** Returns LeftShoulderCamera subobject **/
-    FORCEINLINE class UCameraComponent* GetLeftShoulderCamera() const { return LeftShoulderCamera; }
+    /** Returns FollowCamera subobject **/
+    FORCEINLINE class UCameraComponent* GetFollowCamera() const { return FollowCamera; }
+
+    /** Returns CameraRig subobject **/
+    FORCEINLINE class UCameraRigComponent* GetCameraRig() const { return CameraRig; }
 };
 
@@ -3,9 +3,14 @@
 #include "ProjectChartedGameMode.h"
 #include "ProjectChartedCharacter.h"
 #include "ProjectChartedPlayerController.h"
+#include "ProjectChartedGameState.h"
 
 AProjectChartedGameMode::AProjectChartedGameMode()
 {
 	DefaultPawnClass = AProjectChartedCharacter::StaticClass();
 	PlayerControllerClass = AProjectChartedPlayerController::StaticClass();
+	GameStateClass = AProjectChartedGameState::StaticClass();
+
+	// weapon and character meshes are tagged with the "Game" bundle
+	PreloadedBundles.Add(TEXT("Game"));
 }
@@ -17,10 +17,26 @@ class PROJECTCHARTED_API AProjectChartedGameMode : public AGameModeBase
 {
 	GENERATED_BODY()
 
+protected:
+
+	/** Primary assets (e.g. weapon and character definitions) this mode uses, preloaded by the game state on the server and clients */
+	UPROPERTY(EditDefaultsOnly, Category="Preload", meta=(AllowedTypes="WeaponDefinition,CharacterDefinition"))
+	TArray<FPrimaryAssetId> PreloadedAssets;
+
+	/** Asset bundles loaded along with the preloaded primary assets */
+	UPROPERTY(EditDefaultsOnly, Category="Preload")
+	TArray<FName> PreloadedBundles;
+
 public:
 	
 	/** Constructor */
 	AProjectChartedGameMode();
+
+	/** Primary assets to preload, read from the class defaults by AProjectChartedGameState */
+	const TArray<FPrimaryAssetId>& GetPreloadedAssets() const { return PreloadedAssets; }
+
+	/** Bundles to load with the preloaded primary assets */
+	const TArray<FName>& GetPreloadedBundles() const { return PreloadedBundles; }
 };
 
 
@@ -0,0 +1,49 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ProjectChartedGameState.h"
+#include "ProjectChartedGameMode.h"
+#include "ProjectChartedCharacter.h"
+#include "Engine/AssetManager.h"
+
+void AProjectChartedGameState::ReceivedGameModeClass()
+{
+	Super::ReceivedGameModeClass();
+
+	// the game mode only exists on the server, but its class defaults are available everywhere
+	const AProjectChartedGameMode* GameMode = GetDefaultGameMode<AProjectChartedGameMode>();
+	if (!GameMode || PreloadHandle.IsValid() || PawnPreloadHandle.IsValid())
+	{
+		return;
+	}
+
+	// only the assets listed by this mode are loaded, so other variants' assets stay out of memory
+	if (GameMode->GetPreloadedAssets().Num() > 0)
+	{
+		PreloadHandle = UAssetManager::Get().LoadPrimaryAssets(GameMode->GetPreloadedAssets(), GameMode->GetPreloadedBundles());
+	}
+
+	// the default pawn's mesh and animation, even when it has no character definition listed above
+	if (const AProjectChartedCharacter* PawnDefaults = Cast<AProjectChartedCharacter>(GameMode->DefaultPawnClass ? GameMode->DefaultPawnClass->GetDefaultObject() : nullptr))
+	{
+		TArray<FSoftObjectPath> PawnAssets;
+		PawnDefaults->GetCharacterAssetPaths(PawnAssets);
+		if (PawnAssets.Num() > 0)
+		{
+			PawnPreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(PawnAssets));
+		}
+	}
+}
+
+void AProjectChartedGameState::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	for (TSharedPtr<FStreamableHandle>* Handle : { &PreloadHandle, &PawnPreloadHandle })
+	{
+		if (Handle->IsValid())
+		{
+			(*Handle)->CancelHandle();
+			Handle->Reset();
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
@@ -0,0 +1,34 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/GameStateBase.h"
+#include "Engine/StreamableManager.h"
+#include "ProjectChartedGameState.generated.h"
+
+/**
+ *  GameState for the third person game
+ *  Preloads the assets listed by the game mode on the server and on every client
+ */
+UCLASS()
+class PROJECTCHARTED_API AProjectChartedGameState : public AGameStateBase
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** Keeps the preloaded primary assets and their bundles in memory for the lifetime of the match */
+	TSharedPtr<FStreamableHandle> PreloadHandle;
+
+	/** Keeps the default pawn's appearance assets in memory */
+	TSharedPtr<FStreamableHandle> PawnPreloadHandle;
+
+public:
+
+	/** Called once the game mode class is known: by InitGameState on the server, on replication on clients */
+	virtual void ReceivedGameModeClass() override;
+
+	/** Releases the preloaded assets */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+};
@@ -0,0 +1,118 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ProjectChartedMovementComponent.h"
+#include "GameFramework/Character.h"
+#include "NetBandwidthProfiler.h"
+
+float UProjectChartedMovementComponent::GetMaxSpeed() const
+{
+    if (bWantsToAim && IsMovingOnGround())
+    {
+        return FMath::Min(MaxWalkSpeedAiming, Super::GetMaxSpeed());
+    }
+    return Super::GetMaxSpeed();
+}
+
+void UProjectChartedMovementComponent::UpdateFromCompressedFlags(uint8 Flags)
+{
+    Super::UpdateFromCompressedFlags(Flags);
+
+    bWantsToAim = (Flags & FSavedMove_Character::FLAG_Custom_0) != 0;
+}
+
+bool UProjectChartedMovementComponent::ClientUpdatePositionAfterServerUpdate()
+{
+    // Le rejeu réapplique les drapeaux de chaque mouvement sauvegardé : l'intention courante est restaurée ensuite
+    const bool bRealWantsToAim = bWantsToAim;
+    const bool bResult = Super::ClientUpdatePositionAfterServerUpdate();
+    bWantsToAim = bRealWantsToAim;
+    return bResult;
+}
+
+void UProjectChartedMovementComponent::ServerMovePacked_ClientSend(const FCharacterServerMovePackedBits& PackedBits)
+{
+    if (NetBandwidth::IsEnabled())
+    {
+        static const FName ClassName(TEXT("UProjectChartedMovementComponent"));
+        static const FName ServerMoveName(TEXT("ServerMovePacked"));
+        NetBandwidth::Record(ENetBandwidthKind::Movement, ClassName, ServerMoveName, PackedBits.DataBits.Num(), GetOwner());
+    }
+
+    Super::ServerMovePacked_ClientSend(PackedBits);
+}
+
+void UProjectChartedMovementComponent::ServerMovePacked_ServerReceive(const FCharacterServerMovePackedBits& PackedBits)
+{
+    if (NetBandwidth::IsEnabled())
+    {
+        static const FName ClassName(TEXT("UProjectChartedMovementComponent"));
+        static const FName ServerMoveName(TEXT("ServerMovePacked"));
+        NetBandwidth::Record(ENetBandwidthKind::Movement, ClassName, ServerMoveName, PackedBits.DataBits.Num(), GetOwner());
+    }
+
+    Super::ServerMovePacked_ServerReceive(PackedBits);
+}
+
+void UProjectChartedMovementComponent::MoveResponsePacked_ServerSend(const FCharacterMoveResponsePackedBits& PackedBits)
+{
+    if (NetBandwidth::IsEnabled())
+    {
+        static const FName ClassName(TEXT("UProjectChartedMovementComponent"));
+        static const FName MoveResponseName(TEXT("MoveResponsePacked"));
+        NetBandwidth::Record(ENetBandwidthKind::Movement, ClassName, MoveResponseName, PackedBits.DataBits.Num(), GetOwner());
+    }
+
+    Super::MoveResponsePacked_ServerSend(PackedBits);
+}
+
+FNetworkPredictionData_Client* UProjectChartedMovementComponent::GetPredictionData_Client() const
+{
+    if (!ClientPredictionData)
+    {
+        UProjectChartedMovementComponent* MutableThis = const_cast<UProjectChartedMovementComponent*>(this);
+        MutableThis->ClientPredictionData = new FNetworkPredictionData_Client_ProjectCharted(*this);
+    }
+    return ClientPredictionData;
+}
+
+// --- Mouvements sauvegardés ---
+void FSavedMove_ProjectCharted::Clear()
+{
+    Super::Clear();
+    bSavedWantsToAim = false;
+}
+
+uint8 FSavedMove_ProjectCharted::GetCompressedFlags() const
+{
+    uint8 Flags = Super::GetCompressedFlags();
+    if (bSavedWantsToAim)
+    {
+        Flags |= FLAG_Custom_0;
+    }
+    return Flags;
+}
+
+bool FSavedMove_ProjectCharted::CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const
+{
+    // Ne jamais fusionner deux mouvements de part et d'autre d'un changement de visée
+    if (bSavedWantsToAim != static_cast<const FSavedMove_ProjectCharted*>(NewMove.Get())->bSavedWantsToAim)
+    {
+        return false;
+    }
+    return Super::CanCombineWith(NewMove, InCharacter, MaxDelta);
+}
+
+void FSavedMove_ProjectCharted::SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData)
+{
+    Super::SetMoveFor(C, InDeltaTime, NewAccel, ClientData);
+
+    if (const UProjectChartedMovementComponent* Movement = Cast<UProjectChartedMovementComponent>(C->GetCharacterMovement()))
+    {
+        bSavedWantsToAim = Movement->bWantsToAim;
+    }
+}
+
+FSavedMovePtr FNetworkPredictionData_Client_ProjectCharted::AllocateNewMove()
+{
+    return FSavedMovePtr(new FSavedMove_ProjectCharted());
+}
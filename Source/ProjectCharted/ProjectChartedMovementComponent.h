@@ -0,0 +1,72 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "ProjectChartedMovementComponent.generated.h"
+
+/**
+ * Mouvement du personnage avec visée (ADS) prédite.
+ * L'intention de viser voyage dans les drapeaux compressés des mouvements sauvegardés :
+ * le serveur simule la même vitesse que le client, et les rejeux après correction l'appliquent aussi.
+ */
+UCLASS()
+class UProjectChartedMovementComponent : public UCharacterMovementComponent
+{
+    GENERATED_BODY()
+
+public:
+    // Vitesse de marche en visée
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Character Movement: Walking", meta = (ClampMin = 0, Units = "cm/s"))
+    float MaxWalkSpeedAiming = 250.f;
+
+    // Demande (client local) ou arrête la visée ; prise en compte au prochain mouvement
+    void SetWantsToAim(bool bNewWantsToAim) { bWantsToAim = bNewWantsToAim; }
+
+    bool IsAiming() const { return bWantsToAim; }
+
+    virtual float GetMaxSpeed() const override;
+    virtual void UpdateFromCompressedFlags(uint8 Flags) override;
+    virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+
+protected:
+    virtual bool ClientUpdatePositionAfterServerUpdate() override;
+
+    // Mouvements envoyés et corrections renvoyées, comptés par le profileur de bande passante ;
+    // les mouvements sont aussi comptés à leur réception sur le serveur, pour le budget par joueur
+    virtual void ServerMovePacked_ClientSend(const FCharacterServerMovePackedBits& PackedBits) override;
+    virtual void ServerMovePacked_ServerReceive(const FCharacterServerMovePackedBits& PackedBits) override;
+    virtual void MoveResponsePacked_ServerSend(const FCharacterMoveResponsePackedBits& PackedBits) override;
+
+    // Intention de viser, identique sur le client propriétaire et le serveur pour un même mouvement
+    uint8 bWantsToAim : 1 = false;
+
+    friend class FSavedMove_ProjectCharted;
+};
+
+/**
+ * Mouvement sauvegardé portant l'intention de viser
+ */
+class FSavedMove_ProjectCharted : public FSavedMove_Character
+{
+public:
+    typedef FSavedMove_Character Super;
+
+    virtual void Clear() override;
+    virtual uint8 GetCompressedFlags() const override;
+    virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override;
+    virtual void SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData) override;
+
+    uint8 bSavedWantsToAim : 1 = false;
+};
+
+class FNetworkPredictionData_Client_ProjectCharted : public FNetworkPredictionData_Client_Character
+{
+public:
+    typedef FNetworkPredictionData_Client_Character Super;
+
+    explicit FNetworkPredictionData_Client_ProjectCharted(const UCharacterMovementComponent& ClientMovement) : Super(ClientMovement) {}
+
+    virtual FSavedMovePtr AllocateNewMove() override;
+};
@@ -2,6 +2,37 @@
 
 
 #include "ProjectChartedPlayerController.h"
+#include "EnhancedInputSubsystems.h"
+#include "InputAction.h"
+#include "InputMappingContext.h"
+#include "InputCoreTypes.h"
+#include "Engine/LocalPlayer.h"
+
+namespace PlayerControllerInput
+{
+	/** Template contexts added when none are assigned */
+	const TCHAR* const DefaultContextPaths[] =
+	{
+		TEXT("/Game/Input/IMC_Default.IMC_Default"),
+		TEXT("/Game/Input/IMC_MouseLook.IMC_MouseLook"),
+	};
+}
+
+AProjectChartedPlayerController::AProjectChartedPlayerController()
+{
+	// the template has no assets for the weapon actions, so they are subobjects mapped here
+	AimAction = CreateDefaultSubobject<UInputAction>(TEXT("AimAction"));
+	FireAction = CreateDefaultSubobject<UInputAction>(TEXT("FireAction"));
+	ToggleShoulderAction = CreateDefaultSubobject<UInputAction>(TEXT("ToggleShoulderAction"));
+
+	WeaponMappingContext = CreateDefaultSubobject<UInputMappingContext>(TEXT("WeaponMappingContext"));
+	WeaponMappingContext->MapKey(AimAction, EKeys::RightMouseButton);
+	WeaponMappingContext->MapKey(AimAction, EKeys::Gamepad_LeftTrigger);
+	WeaponMappingContext->MapKey(FireAction, EKeys::LeftMouseButton);
+	WeaponMappingContext->MapKey(FireAction, EKeys::Gamepad_RightTrigger);
+	WeaponMappingContext->MapKey(ToggleShoulderAction, EKeys::X);
+	WeaponMappingContext->MapKey(ToggleShoulderAction, EKeys::Gamepad_RightThumbstick);
+}
 
 void AProjectChartedPlayerController::BeginPlay()
 {
@@ -12,4 +43,36 @@ void AProjectChartedPlayerController::BeginPlay()
 	SetInputMode(FInputModeGameOnly());
 }
 
-// Suppression de SetupInputComponent (non ncessaire ici)
+void AProjectChartedPlayerController::SetupInputComponent()
+{
+	Super::SetupInputComponent();
+
+	// only local player controllers have an input subsystem
+	if (IsLocalPlayerController())
+	{
+		if (UEnhancedInputLocalPlayerSubsystem* Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(GetLocalPlayer()))
+		{
+			// the native controller has no assigned contexts; fall back to the template's
+			if (DefaultMappingContexts.IsEmpty())
+			{
+				for (const TCHAR* Path : PlayerControllerInput::DefaultContextPaths)
+				{
+					if (UInputMappingContext* Context = TSoftObjectPtr<UInputMappingContext>(FSoftObjectPath(Path)).LoadSynchronous())
+					{
+						DefaultMappingContexts.Add(Context);
+					}
+				}
+			}
+
+			for (UInputMappingContext* CurrentContext : DefaultMappingContexts)
+			{
+				Subsystem->AddMappingContext(CurrentContext, 0);
+			}
+
+			if (WeaponMappingContext)
+			{
+				Subsystem->AddMappingContext(WeaponMappingContext, 0);
+			}
+		}
+	}
+}
@@ -6,9 +6,14 @@
 #include "GameFramework/PlayerController.h"
 #include "ProjectChartedPlayerController.generated.h"
 
+class UInputAction;
+class UInputMappingContext;
+
 /**
  *  Basic PlayerController class for a third person game
  *  Manages input mappings
+ *  Without Blueprint setup, adds the template's /Game/Input contexts and native weapon actions,
+ *  so the native character stays playable
  */
 UCLASS()
 class PROJECTCHARTED_API AProjectChartedPlayerController : public APlayerController
@@ -16,6 +21,38 @@ class PROJECTCHARTED_API AProjectChartedPlayerController : public APlayerControl
 	GENERATED_BODY()
 
 protected:
+
+	/** Input mapping contexts added for the local player. If empty, /Game/Input/IMC_Default and IMC_MouseLook are loaded */
+	UPROPERTY(EditAnywhere, Category="Input|Input Mappings")
+	TArray<UInputMappingContext*> DefaultMappingContexts;
+
+	/** Maps the weapon actions below (mouse buttons and X, gamepad triggers and right thumbstick). Clear it when the contexts above map them */
+	UPROPERTY(EditAnywhere, Category="Input|Input Mappings")
+	TObjectPtr<UInputMappingContext> WeaponMappingContext;
+
+	/** Weapon actions used by characters that don't assign their own */
+	UPROPERTY(VisibleAnywhere, Category="Input|Weapon")
+	TObjectPtr<UInputAction> AimAction;
+
+	UPROPERTY(VisibleAnywhere, Category="Input|Weapon")
+	TObjectPtr<UInputAction> FireAction;
+
+	UPROPERTY(VisibleAnywhere, Category="Input|Weapon")
+	TObjectPtr<UInputAction> ToggleShoulderAction;
+
+public:
+
+	/** Constructor */
+	AProjectChartedPlayerController();
+
+	UInputAction* GetAimAction() const { return AimAction; }
+	UInputAction* GetFireAction() const { return FireAction; }
+	UInputAction* GetToggleShoulderAction() const { return ToggleShoulderAction; }
+
+protected:
+
 	virtual void BeginPlay() override;
-    // Suppression de SetupInputComponent (non ncessaire ici)
+
+	/** Adds the input mapping contexts */
+	virtual void SetupInputComponent() override;
 };
@@ -0,0 +1,104 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ProjectChartedReplicationGraph.h"
+#include "ProjectChartedCharacter.h"
+#include "Weapon.h"
+#include "GameFramework/PlayerState.h"
+
+void UProjectChartedReplicationGraph::InitGlobalActorClassSettings()
+{
+    Super::InitGlobalActorClassSettings();
+
+    // Personnages : cellules voisines uniquement, au-delà de la distance de pertinence ils sont ignorés
+    FClassReplicationInfo PawnInfo;
+    PawnInfo.SetCullDistanceSquared(FMath::Square(PawnCullDistance));
+    PawnInfo.ReplicationPeriodFrame = GetReplicationPeriodFrameForFrequency(GetDefault<AProjectChartedCharacter>()->GetNetUpdateFrequency());
+    GlobalActorReplicationInfoMap.SetClassInfo(AProjectChartedCharacter::StaticClass(), PawnInfo);
+
+    // PlayerState : toujours pertinent mais rarement modifié
+    FClassReplicationInfo PlayerStateInfo;
+    PlayerStateInfo.SetCullDistanceSquared(0.f);
+    PlayerStateInfo.ReplicationPeriodFrame = GetReplicationPeriodFrameForFrequency(PlayerStateFrequency);
+    GlobalActorReplicationInfoMap.SetClassInfo(APlayerState::StaticClass(), PlayerStateInfo);
+
+    // Coût réel par classe (bits écrits et temps de réplication), catégorie CSV ReplicationGraph
+    CSVTracker.SetExplicitClassTracking(AProjectChartedCharacter::StaticClass(), TEXT("Character"));
+    CSVTracker.SetExplicitClassTracking(AWeapon::StaticClass(), TEXT("Weapon"));
+    CSVTracker.SetExplicitClassTracking(APlayerState::StaticClass(), TEXT("PlayerState"));
+}
+
+void UProjectChartedReplicationGraph::InitGlobalGraphNodes()
+{
+    Super::InitGlobalGraphNodes();
+
+    GridNode->CellSize = GridCellSize;
+
+    WeaponOwnerChangedHandle = AWeapon::OnOwnerChanged.AddUObject(this, &UProjectChartedReplicationGraph::HandleWeaponOwnerChanged);
+}
+
+void UProjectChartedReplicationGraph::BeginDestroy()
+{
+    AWeapon::OnOwnerChanged.Remove(WeaponOwnerChangedHandle);
+
+    Super::BeginDestroy();
+}
+
+void UProjectChartedReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+    if (AWeapon* Weapon = Cast<AWeapon>(ActorInfo.Actor))
+    {
+        AddWeapon(Weapon, Weapon->GetOwner());
+        return;
+    }
+
+    Super::RouteAddNetworkActorToNodes(ActorInfo, GlobalInfo);
+}
+
+void UProjectChartedReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+    if (AWeapon* Weapon = Cast<AWeapon>(ActorInfo.Actor))
+    {
+        RemoveWeapon(Weapon, Weapon->GetOwner());
+        return;
+    }
+
+    Super::RouteRemoveNetworkActorToNodes(ActorInfo);
+}
+
+void UProjectChartedReplicationGraph::AddWeapon(AWeapon* Weapon, AActor* Owner)
+{
+    if (Owner)
+    {
+        // Répliquée avec son porteur, à sa fréquence et selon sa pertinence
+        GlobalActorReplicationInfoMap.AddDependentActor(Owner, Weapon);
+    }
+    else
+    {
+        GridNode->AddActor_Dormancy(FNewReplicatedActorInfo(Weapon), GlobalActorReplicationInfoMap.Get(Weapon));
+        GroundWeapons.Add(Weapon);
+    }
+}
+
+void UProjectChartedReplicationGraph::RemoveWeapon(AWeapon* Weapon, AActor* Owner)
+{
+    if (GroundWeapons.Remove(Weapon) > 0)
+    {
+        GridNode->RemoveActor_Dormancy(FNewReplicatedActorInfo(Weapon));
+    }
+    else if (Owner && GlobalActorReplicationInfoMap.Find(Owner))
+    {
+        GlobalActorReplicationInfoMap.RemoveDependentActor(Owner, Weapon);
+    }
+}
+
+void UProjectChartedReplicationGraph::HandleWeaponOwnerChanged(AWeapon* Weapon, AActor* OldOwner, AActor* NewOwner)
+{
+    // Arme pas encore ajoutée au graphe (changement de porteur au spawn) : RouteAddNetworkActorToNodes s'en chargera
+    if (!Weapon || Weapon->GetWorld() != GetWorld() || !GlobalActorReplicationInfoMap.Find(Weapon))
+    {
+        return;
+    }
+
+    RemoveWeapon(Weapon, OldOwner);
+    AddWeapon(Weapon, NewOwner);
+}
@@ -0,0 +1,56 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BasicReplicationGraph.h"
+#include "ProjectChartedReplicationGraph.generated.h"
+
+class AWeapon;
+
+/**
+ * Graphe de réplication du projet.
+ * - Pawns et acteurs mobiles : grille spatiale 2D, chaque connexion ne parcourt que ses cellules
+ * - Armes tenues ou rangées dans le pool : acteurs dépendants de leur porteur, répliquées avec lui
+ *   et jamais évaluées seules
+ * - Armes au sol : grille spatiale, en tenant compte de leur dormance
+ * - GameState et acteurs bAlwaysRelevant : noeud toujours pertinent ; PlayerState à fréquence réduite
+ * Le coût serveur par connexion ne dépend plus du nombre total de joueurs.
+ */
+UCLASS(transient, config = Engine)
+class UProjectChartedReplicationGraph : public UBasicReplicationGraph
+{
+    GENERATED_BODY()
+
+public:
+    virtual void InitGlobalActorClassSettings() override;
+    virtual void InitGlobalGraphNodes() override;
+    virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+    virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+    virtual void BeginDestroy() override;
+
+protected:
+    // Taille d'une cellule de la grille spatiale
+    UPROPERTY(Config)
+    float GridCellSize = 10000.f;
+
+    // Distance de pertinence des personnages
+    UPROPERTY(Config)
+    float PawnCullDistance = 15000.f;
+
+    // Fréquence de réplication des PlayerState (score, ping)
+    UPROPERTY(Config)
+    float PlayerStateFrequency = 2.f;
+
+private:
+    // Déplace l'arme entre la grille (au sol) et la liste des dépendants de son porteur
+    void HandleWeaponOwnerChanged(AWeapon* Weapon, AActor* OldOwner, AActor* NewOwner);
+
+    void AddWeapon(AWeapon* Weapon, AActor* Owner);
+    void RemoveWeapon(AWeapon* Weapon, AActor* Owner);
+
+    // Armes actuellement dans la grille
+    TSet<TObjectKey<AWeapon>> GroundWeapons;
+
+    FDelegateHandle WeaponOwnerChangedHandle;
+};
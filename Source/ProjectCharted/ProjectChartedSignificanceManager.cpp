@@ -0,0 +1,188 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ProjectChartedSignificanceManager.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/PlayerController.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/WidgetComponent.h"
+#include "Engine/World.h"
+
+namespace CharacterSignificance
+{
+    const FName Tag = TEXT("Character");
+
+    // Significativité des personnages jamais ralentis
+    constexpr float Forced = TNumericLimits<float>::Max();
+
+    struct FSettings
+    {
+        // Intervalle de tick de l'acteur
+        float ActorTickInterval;
+        // Intervalle de mise à jour de l'animation
+        float AnimTickInterval;
+        // Optimisations de fréquence d'animation du moteur (URO)
+        bool bUpdateRateOptimizations;
+        // Intervalle de rafraîchissement des widgets (barre de vie)
+        float WidgetRedrawTime;
+    };
+
+    constexpr FSettings Settings[] =
+    {
+        /* High    */ { 0.f,         0.f,         false, 0.f   },
+        /* Medium  */ { 1.f / 30.f,  1.f / 30.f,  true,  0.1f  },
+        /* Low     */ { 0.1f,        1.f / 15.f,  true,  0.25f },
+        /* Minimal */ { 0.25f,       0.2f,        true,  1.f   },
+    };
+    static_assert(UE_ARRAY_COUNT(Settings) == int32(ECharacterSignificance::Minimal) + 1);
+}
+
+void UProjectChartedSignificanceManager::RegisterCharacter(ACharacter* Character)
+{
+    if (UProjectChartedSignificanceManager* Manager = USignificanceManager::Get<UProjectChartedSignificanceManager>(Character->GetWorld()))
+    {
+        Manager->RegisterObject(Character, CharacterSignificance::Tag,
+            [Manager](FManagedObjectInfo* ObjectInfo, const FTransform& Viewpoint) { return Manager->CalculateSignificance(ObjectInfo, Viewpoint); });
+    }
+}
+
+void UProjectChartedSignificanceManager::UnregisterCharacter(ACharacter* Character)
+{
+    if (UProjectChartedSignificanceManager* Manager = USignificanceManager::Get<UProjectChartedSignificanceManager>(Character->GetWorld()))
+    {
+        Manager->UnregisterObject(Character);
+    }
+}
+
+void UProjectChartedSignificanceManager::UnregisterObject(UObject* Object)
+{
+    Super::UnregisterObject(Object);
+
+    if (ACharacter* Character = Cast<ACharacter>(Object))
+    {
+        CurrentSignificance.Remove(Character);
+    }
+}
+
+ECharacterSignificance UProjectChartedSignificanceManager::GetCharacterSignificance(const ACharacter* Character) const
+{
+    const ECharacterSignificance* Current = CurrentSignificance.Find(Character);
+    return Current ? *Current : ECharacterSignificance::High;
+}
+
+bool UProjectChartedSignificanceManager::IsBeyondLowDistance(const ACharacter* Character) const
+{
+    // Significance de la dernière mise à jour : la plus forte sur l'ensemble des points de vue
+    return GetDistanceSignificance(GetSignificance(Character)) == ECharacterSignificance::Minimal;
+}
+
+float UProjectChartedSignificanceManager::CalculateSignificance(const FManagedObjectInfo* ObjectInfo, const FTransform& Viewpoint) const
+{
+    const ACharacter* Character = CastChecked<ACharacter>(ObjectInfo->GetObject());
+
+    // Le joueur local, et sur le serveur tout personnage joueur (mouvement, compensation de latence), restent à pleine cadence
+    if (Character->IsLocallyControlled() || (Character->HasAuthority() && Character->IsPlayerControlled()))
+    {
+        return CharacterSignificance::Forced;
+    }
+
+    float Distance = FVector::Dist(Character->GetActorLocation(), Viewpoint.GetLocation());
+
+    // Un serveur dédié ne rend rien : la visibilité n'y a pas de sens
+    if (Character->GetNetMode() != NM_DedicatedServer && !Character->WasRecentlyRendered(0.25f))
+    {
+        Distance *= HiddenDistanceScale;
+    }
+
+    // Plus c'est proche, plus c'est significatif
+    return -Distance;
+}
+
+ECharacterSignificance UProjectChartedSignificanceManager::GetDistanceSignificance(float Significance) const
+{
+    const float Distance = -Significance;
+    if (Distance <= HighDistance) return ECharacterSignificance::High;
+    if (Distance <= MediumDistance) return ECharacterSignificance::Medium;
+    if (Distance <= LowDistance) return ECharacterSignificance::Low;
+    return ECharacterSignificance::Minimal;
+}
+
+void UProjectChartedSignificanceManager::Tick(float DeltaTime)
+{
+    UWorld* World = GetWorld();
+
+    // Un point de vue par joueur (serveur : tous les joueurs connectés ; client : le joueur local)
+    Viewpoints.Reset();
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        if (const APlayerController* PlayerController = It->Get())
+        {
+            FVector Location;
+            FRotator Rotation;
+            PlayerController->GetPlayerViewPoint(Location, Rotation);
+            Viewpoints.Emplace(Rotation, Location);
+        }
+    }
+
+    Update(Viewpoints);
+
+    // Objets triés du plus au moins significatif : le rang applique les budgets par niveau
+    const int32 MediumBudgetStart = MaxHighCharacters;
+    const int32 LowBudgetStart = MediumBudgetStart + MaxMediumCharacters;
+    const int32 MinimalBudgetStart = LowBudgetStart + MaxLowCharacters;
+
+    int32 Rank = 0;
+    for (const FManagedObjectInfo* ObjectInfo : GetManagedObjects(CharacterSignificance::Tag))
+    {
+        ACharacter* Character = CastChecked<ACharacter>(ObjectInfo->GetObject());
+        const float Significance = ObjectInfo->GetSignificance();
+
+        ECharacterSignificance Level = ECharacterSignificance::High;
+        if (!bForceHighSignificance && Significance != CharacterSignificance::Forced)
+        {
+            const ECharacterSignificance BudgetLevel = Rank >= MinimalBudgetStart ? ECharacterSignificance::Minimal
+                : Rank >= LowBudgetStart ? ECharacterSignificance::Low
+                : Rank >= MediumBudgetStart ? ECharacterSignificance::Medium
+                : ECharacterSignificance::High;
+            Level = FMath::Max(GetDistanceSignificance(Significance), BudgetLevel);
+        }
+        ++Rank;
+
+        // Les réglages ne sont touchés qu'au changement de niveau
+        ECharacterSignificance* Current = CurrentSignificance.Find(Character);
+        if (!Current || *Current != Level)
+        {
+            CurrentSignificance.Add(Character, Level);
+            ApplySignificance(Character, Level);
+        }
+    }
+}
+
+void UProjectChartedSignificanceManager::ApplySignificance(ACharacter* Character, ECharacterSignificance Significance)
+{
+    const CharacterSignificance::FSettings& Settings = CharacterSignificance::Settings[int32(Significance)];
+
+    Character->SetActorTickInterval(Settings.ActorTickInterval);
+
+    if (USkeletalMeshComponent* Mesh = Character->GetMesh())
+    {
+        Mesh->SetComponentTickInterval(Settings.AnimTickInterval);
+        Mesh->bEnableUpdateRateOptimizations = Settings.bUpdateRateOptimizations;
+    }
+
+    TInlineComponentArray<UWidgetComponent*> Widgets(Character);
+    for (UWidgetComponent* Widget : Widgets)
+    {
+        Widget->SetRedrawTime(Settings.WidgetRedrawTime);
+        Widget->SetComponentTickInterval(Settings.WidgetRedrawTime);
+    }
+}
+
+ETickableTickType UProjectChartedSignificanceManager::GetTickableTickType() const
+{
+    return HasAnyFlags(RF_ClassDefaultObject) ? ETickableTickType::Never : ETickableTickType::Always;
+}
+
+TStatId UProjectChartedSignificanceManager::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UProjectChartedSignificanceManager, STATGROUP_Tickables);
+}
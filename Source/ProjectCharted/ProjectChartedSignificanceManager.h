@@ -0,0 +1,104 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SignificanceManager.h"
+#include "Tickable.h"
+#include "ProjectChartedSignificanceManager.generated.h"
+
+class ACharacter;
+
+/**
+ * Niveau de significativité d'un personnage ; chaque niveau a ses fréquences de mise à jour
+ */
+UENUM()
+enum class ECharacterSignificance : uint8
+{
+    // Cadence pleine (personnages proches, joueur local)
+    High,
+    Medium,
+    Low,
+    // Hors de portée ou au-delà des budgets
+    Minimal
+};
+
+/**
+ * Gestionnaire de significativité des personnages.
+ * Chaque frame, les personnages sont classés selon leur distance au point de vue le plus proche
+ * (pénalisée s'ils ne sont pas visibles) puis répartis en niveaux avec un nombre maximal
+ * de personnages par niveau : le coût du game thread reste borné quelle que soit la taille de l'arène.
+ * Le niveau règle l'intervalle de tick de l'acteur, la mise à jour de l'animation (URO)
+ * et le rafraîchissement des widgets.
+ */
+UCLASS(config = Game)
+class UProjectChartedSignificanceManager : public USignificanceManager, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+public:
+    // À appeler depuis BeginPlay / EndPlay de chaque personnage
+    static void RegisterCharacter(ACharacter* Character);
+    static void UnregisterCharacter(ACharacter* Character);
+
+    // Niveau appliqué au personnage lors de la dernière mise à jour ; High s'il n'a pas encore été classé
+    ECharacterSignificance GetCharacterSignificance(const ACharacter* Character) const;
+
+    // Tous les personnages à High, quels que soient les points de vue et les budgets (mode soak : un serveur
+    // sans joueur n'a aucun point de vue, et le coût mesuré doit être celui de bots à pleine cadence)
+    void SetForceHighSignificance(bool bForce) { bForceHighSignificance = bForce; }
+
+    // Vrai si le personnage est au-delà de LowDistance de tous les points de vue (Minimal par la distance et non par les budgets)
+    bool IsBeyondLowDistance(const ACharacter* Character) const;
+
+    // USignificanceManager
+    virtual void UnregisterObject(UObject* Object) override;
+
+    // FTickableGameObject
+    virtual void Tick(float DeltaTime) override;
+    virtual ETickableTickType GetTickableTickType() const override;
+    virtual TStatId GetStatId() const override;
+    virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+protected:
+    // Distances maximales de chaque niveau
+    UPROPERTY(Config)
+    float HighDistance = 2000.f;
+
+    UPROPERTY(Config)
+    float MediumDistance = 5000.f;
+
+    UPROPERTY(Config)
+    float LowDistance = 10000.f;
+
+    // Multiplicateur de distance d'un personnage qui n'a pas été rendu récemment
+    UPROPERTY(Config)
+    float HiddenDistanceScale = 2.f;
+
+    // Nombre maximal de personnages par niveau ; les suivants descendent d'un niveau
+    UPROPERTY(Config)
+    int32 MaxHighCharacters = 8;
+
+    UPROPERTY(Config)
+    int32 MaxMediumCharacters = 24;
+
+    UPROPERTY(Config)
+    int32 MaxLowCharacters = 48;
+
+private:
+    // Appelé par Update, éventuellement en parallèle : ne lit que des données constantes
+    float CalculateSignificance(const FManagedObjectInfo* ObjectInfo, const FTransform& Viewpoint) const;
+
+    ECharacterSignificance GetDistanceSignificance(float Significance) const;
+
+    // Applique les fréquences du niveau au personnage
+    static void ApplySignificance(ACharacter* Character, ECharacterSignificance Significance);
+
+    // Niveau actuellement appliqué à chaque personnage
+    TMap<TObjectKey<ACharacter>, ECharacterSignificance> CurrentSignificance;
+
+    // Points de vue des joueurs (réutilisé d'une frame à l'autre)
+    TArray<FTransform> Viewpoints;
+
+    bool bForceHighSignificance = false;
+};
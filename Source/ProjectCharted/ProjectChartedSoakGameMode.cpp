@@ -0,0 +1,195 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ProjectChartedSoakGameMode.h"
+#include "ProjectChartedCharacter.h"
+#include "SoakBotController.h"
+#include "ProjectChartedSignificanceManager.h"
+#include "SampleStats.h"
+#include "Engine/World.h"
+#include "Engine/NetDriver.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSoak, Log, All);
+
+AProjectChartedSoakGameMode::AProjectChartedSoakGameMode()
+{
+    PrimaryActorTick.bCanEverTick = true;
+    BotControllerClass = ASoakBotController::StaticClass();
+
+    GameThreadMs.Name = TEXT("GameThreadMs");
+    FrameMs.Name = TEXT("FrameMs");
+    OutKBps.Name = TEXT("OutKBps");
+    InKBps.Name = TEXT("InKBps");
+    UsedMemoryMB.Name = TEXT("UsedMemoryMB");
+    ActorCount.Name = TEXT("ActorCount");
+}
+
+void AProjectChartedSoakGameMode::InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage)
+{
+    Super::InitGame(MapName, Options, ErrorMessage);
+
+    NumBots = FMath::Max(UGameplayStatics::GetIntOption(Options, TEXT("Bots"), NumBots), 0);
+    Duration = FMath::Max(float(UGameplayStatics::GetIntOption(Options, TEXT("Duration"), int32(Duration))), 1.f);
+    WarmUp = FMath::Max(float(UGameplayStatics::GetIntOption(Options, TEXT("WarmUp"), int32(WarmUp))), 0.f);
+    NumFrames = FMath::Max(UGameplayStatics::GetIntOption(Options, TEXT("Frames"), NumFrames), 0);
+
+    BotPawnClass = DefaultPawnClass;
+    const FString BotPawnPath = UGameplayStatics::ParseOption(Options, TEXT("BotPawn"));
+    if (!BotPawnPath.IsEmpty())
+    {
+        if (UClass* PawnClass = LoadClass<APawn>(nullptr, *BotPawnPath))
+        {
+            BotPawnClass = PawnClass;
+        }
+        else
+        {
+            UE_LOG(LogSoak, Error, TEXT("Soak: BotPawn %s could not be loaded, using %s"), *BotPawnPath, *GetNameSafe(BotPawnClass));
+        }
+    }
+
+    CsvPath = UGameplayStatics::ParseOption(Options, TEXT("SoakCsv"));
+    if (CsvPath.IsEmpty())
+    {
+        CsvPath = FPaths::ProfilingDir() / TEXT("Soak") / FString::Printf(TEXT("Soak-%s.csv"), *FDateTime::Now().ToString());
+    }
+
+    if (NumFrames > 0)
+    {
+        UE_LOG(LogSoak, Display, TEXT("Soak: %d bots, %d frames (+%.0f s warm-up) -> %s"), NumBots, NumFrames, WarmUp, *CsvPath);
+    }
+    else
+    {
+        UE_LOG(LogSoak, Display, TEXT("Soak: %d bots, %.0f s (+%.0f s warm-up) -> %s"), NumBots, Duration, WarmUp, *CsvPath);
+    }
+}
+
+void AProjectChartedSoakGameMode::StartPlay()
+{
+    Super::StartPlay();
+
+    // Sans client, le gestionnaire n'a aucun point de vue et mettrait tous les bots à Minimal (tick à 4 Hz)
+    if (UProjectChartedSignificanceManager* Significance = USignificanceManager::Get<UProjectChartedSignificanceManager>(GetWorld()))
+    {
+        Significance->SetForceHighSignificance(true);
+    }
+
+    SpawnBots();
+    SoakStartTime = GetWorld()->GetTimeSeconds();
+}
+
+void AProjectChartedSoakGameMode::SpawnBots()
+{
+    SpawnRandom.Initialize(NumBots);
+    for (int32 Index = 0; Index < NumBots; ++Index)
+    {
+        SpawnBot(nullptr);
+    }
+}
+
+void AProjectChartedSoakGameMode::SpawnBot(AController* Controller)
+{
+    const AActor* Start = FindPlayerStart(nullptr);
+    const FVector Origin = Start ? Start->GetActorLocation() : FVector::ZeroVector;
+
+    const float Angle = SpawnRandom.FRandRange(0.f, UE_TWO_PI);
+    const float Radius = SpawnRandom.FRandRange(0.f, SpawnRadius);
+    const FVector Location = Origin + FVector(FMath::Cos(Angle) * Radius, FMath::Sin(Angle) * Radius, 0.f);
+    const FRotator Rotation(0.f, SpawnRandom.FRandRange(-180.f, 180.f), 0.f);
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+    APawn* Bot = GetWorld()->SpawnActor<APawn>(BotPawnClass, Location, Rotation, SpawnParams);
+    if (!Bot) return;
+
+    if (!Controller)
+    {
+        Controller = GetWorld()->SpawnActor<AController>(BotControllerClass, Location, Rotation);
+    }
+    if (Controller)
+    {
+        Controller->Possess(Bot);
+    }
+}
+
+void AProjectChartedSoakGameMode::RestartPlayer(AController* NewPlayer)
+{
+    if (Cast<ASoakBotController>(NewPlayer))
+    {
+        SpawnBot(NewPlayer);
+        return;
+    }
+    Super::RestartPlayer(NewPlayer);
+}
+
+void AProjectChartedSoakGameMode::Tick(float DeltaSeconds)
+{
+    Super::Tick(DeltaSeconds);
+
+    if (bFinished) return;
+
+    const double Elapsed = GetWorld()->GetTimeSeconds() - SoakStartTime;
+    if (Elapsed < WarmUp) return;
+
+    // Temps de travail de la frame : le serveur dort jusqu'à sa fréquence de tick, ce sommeil est retiré
+    const double FrameSeconds = FApp::GetDeltaTime();
+    FrameMs.Samples.Add(float(FrameSeconds * 1000.0));
+    GameThreadMs.Samples.Add(float(FMath::Max(FrameSeconds - FApp::GetIdleTime(), 0.0) * 1000.0));
+
+    // Débit réseau : seulement avec des clients connectés, les bots n'envoient ni ne reçoivent rien
+    const UNetDriver* NetDriver = GetWorld()->GetNetDriver();
+    if (NetDriver && NetDriver->ClientConnections.Num() > 0)
+    {
+        OutKBps.Samples.Add(NetDriver->OutBytesPerSecond / 1024.f);
+        InKBps.Samples.Add(NetDriver->InBytesPerSecond / 1024.f);
+    }
+
+    UsedMemoryMB.Samples.Add(float(FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0)));
+    ActorCount.Samples.Add(float(GetWorld()->GetActorCount()));
+
+    ++MeasuredFrames;
+    if (NumFrames > 0 ? MeasuredFrames >= NumFrames : Elapsed >= WarmUp + Duration)
+    {
+        FinishSoak();
+    }
+}
+
+FString AProjectChartedSoakGameMode::BuildReport() const
+{
+    FString Report = TEXT("Metric,Bots,Samples,Mean,P50,P90,P95,P99,Max\n");
+
+    for (const FSoakMetric* Metric : { &GameThreadMs, &FrameMs, &OutKBps, &InKBps, &UsedMemoryMB, &ActorCount })
+    {
+        // Métrique jamais mesurée (débit sans client) : pas de ligne plutôt qu'une ligne de zéros
+        if (Metric->Samples.IsEmpty() && Metric != &GameThreadMs) continue;
+
+        TArray<float> Sorted = Metric->Samples;
+        Sorted.Sort();
+
+        Report += FString::Printf(TEXT("%s,%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n"), *Metric->Name, NumBots, Sorted.Num(), SampleStats::Mean(Sorted),
+            SampleStats::Percentile(Sorted, 0.5f), SampleStats::Percentile(Sorted, 0.9f), SampleStats::Percentile(Sorted, 0.95f),
+            SampleStats::Percentile(Sorted, 0.99f), SampleStats::Percentile(Sorted, 1.f));
+    }
+    return Report;
+}
+
+void AProjectChartedSoakGameMode::FinishSoak()
+{
+    bFinished = true;
+
+    const FString Report = BuildReport();
+    if (FFileHelper::SaveStringToFile(Report, *CsvPath))
+    {
+        UE_LOG(LogSoak, Display, TEXT("Soak finished, results written to %s\n%s"), *CsvPath, *Report);
+    }
+    else
+    {
+        UE_LOG(LogSoak, Error, TEXT("Soak finished but %s could not be written\n%s"), *CsvPath, *Report);
+    }
+
+    FPlatformMisc::RequestExit(false, TEXT("AProjectChartedSoakGameMode::FinishSoak"));
+}
@@ -0,0 +1,89 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProjectChartedGameMode.h"
+#include "ProjectChartedSoakGameMode.generated.h"
+
+class ASoakBotController;
+
+/**
+ * Mode soak headless : fait apparaître N bots qui se déplacent et tirent, mesure le serveur
+ * pendant une durée fixe, écrit les percentiles dans un CSV puis quitte.
+ *
+ * Exemple sur une machine Linux sans GPU :
+ *   ProjectChartedServer /Game/ThirdPerson/Lvl_ThirdPerson?game=Soak?Bots=64?Duration=300 -nullrhi -log
+ *
+ * Options d'URL : Bots (nombre de bots), Duration et WarmUp (secondes), Frames (nombre de frames mesurées,
+ * remplace Duration), BotPawn (classe des bots ; par défaut celle du mode), SoakCsv (chemin du fichier ;
+ * par défaut Saved/Profiling/Soak/Soak-<date>.csv).
+ *
+ * Les bots n'ont pas de connexion : les lignes OutKBps et InKBps ne sont mesurées et écrites que si de vrais
+ * clients sont connectés, par exemple des clients headless lancés à côté du serveur :
+ *   ProjectCharted 127.0.0.1 -nullrhi -nosound -unattended
+ *
+ * Les budgets de performance par carte sont vérifiés par les tests d'automatisation ProjectCharted.Performance
+ * (module ProjectChartedTests) ; le soak ne fait que mesurer.
+ */
+UCLASS()
+class AProjectChartedSoakGameMode : public AProjectChartedGameMode
+{
+    GENERATED_BODY()
+
+public:
+    AProjectChartedSoakGameMode();
+
+    virtual void InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage) override;
+    virtual void StartPlay() override;
+    virtual void Tick(float DeltaSeconds) override;
+
+    // Un bot tué réapparaît dans la zone de dispersion, avec la classe de pawn du soak
+    virtual void RestartPlayer(AController* NewPlayer) override;
+
+    // Une série de mesures et ses percentiles
+    struct FSoakMetric
+    {
+        FString Name;
+        TArray<float> Samples;
+    };
+
+    // Résultat courant au format CSV (une ligne par métrique)
+    FString BuildReport() const;
+
+protected:
+    UPROPERTY(EditDefaultsOnly, Category = "Soak")
+    TSubclassOf<ASoakBotController> BotControllerClass;
+
+    // Rayon de dispersion des bots autour du point de départ
+    UPROPERTY(EditDefaultsOnly, Category = "Soak", meta = (ClampMin = 0, Units = "cm"))
+    float SpawnRadius = 3000.f;
+
+    int32 NumBots = 32;
+    float Duration = 300.f;
+    float WarmUp = 10.f;
+    int32 NumFrames = 0;
+    FString CsvPath;
+
+    // Classe des bots, remplaçable par carte pour mesurer le personnage de chaque variante
+    TSubclassOf<APawn> BotPawnClass;
+
+private:
+    void SpawnBots();
+
+    // Fait apparaître un pawn de bot à un point tiré dans SpawnRadius et le confie au contrôleur (créé si nul)
+    void SpawnBot(AController* Controller);
+    void FinishSoak();
+
+    double SoakStartTime = 0.0;
+    int32 MeasuredFrames = 0;
+    FRandomStream SpawnRandom;
+    bool bFinished = false;
+
+    FSoakMetric GameThreadMs;
+    FSoakMetric FrameMs;
+    FSoakMetric OutKBps;
+    FSoakMetric InKBps;
+    FSoakMetric UsedMemoryMB;
+    FSoakMetric ActorCount;
+};
@@ -0,0 +1,224 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ProjectileSubsystem.h"
+#include "Weapon.h"
+#include "CombatDamageable.h"
+#include "Engine/World.h"
+
+void UProjectileSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    TraceDelegate.BindUObject(this, &UProjectileSubsystem::OnTraceCompleted);
+
+    // Préallocation du pool : aucune allocation pendant la partie
+    for (TArray<float>* Stream : { &PosX, &PosY, &PosZ, &PrevX, &PrevY, &PrevZ, &VelX, &VelY, &VelZ, &Gravity, &Life, &Damage, &Impulse })
+    {
+        Stream->SetNumZeroed(MaxProjectiles);
+    }
+    ShotIds.SetNumZeroed(MaxProjectiles);
+    bDead.SetNumZeroed(MaxProjectiles);
+    Weapons.SetNum(MaxProjectiles);
+    Instigators.SetNum(MaxProjectiles);
+    PendingImpacts.Reserve(MaxProjectiles);
+    PendingImpactIndices.Reserve(MaxProjectiles);
+}
+
+void UProjectileSubsystem::Deinitialize()
+{
+    TraceDelegate.Unbind();
+    NumLive = 0;
+    Super::Deinitialize();
+}
+
+bool UProjectileSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UProjectileSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UProjectileSubsystem, STATGROUP_Tickables);
+}
+
+bool UProjectileSubsystem::Launch(const FProjectileLaunch& Params)
+{
+    if (NumLive >= MaxProjectiles)
+    {
+        return false;
+    }
+
+    // Avance balistique du temps déjà écoulé, gravité comprise
+    const float Age = FMath::Clamp(Params.Age, 0.f, Params.Lifetime);
+    const FVector GravityVelocity(0.f, 0.f, GetWorld()->GetGravityZ() * Params.GravityScale * Age);
+    const FVector Position = Params.Start + (Params.Velocity + 0.5f * GravityVelocity) * Age;
+    const FVector Velocity = Params.Velocity + GravityVelocity;
+
+    const int32 Index = NumLive++;
+    PosX[Index] = PrevX[Index] = Position.X;
+    PosY[Index] = PrevY[Index] = Position.Y;
+    PosZ[Index] = PrevZ[Index] = Position.Z;
+    VelX[Index] = Velocity.X;
+    VelY[Index] = Velocity.Y;
+    VelZ[Index] = Velocity.Z;
+    Gravity[Index] = Params.GravityScale;
+    Life[Index] = Params.Lifetime - Age;
+    Damage[Index] = Params.Damage;
+    Impulse[Index] = Params.Impulse;
+    ShotIds[Index] = Params.ShotId;
+    bDead[Index] = false;
+    Weapons[Index] = Params.Weapon;
+    Instigators[Index] = Params.Instigator;
+
+    // Le trajet sauté est balayé tout de suite : sinon le projectile traverserait murs et personnages près du canon
+    if (Age > 0.f)
+    {
+        SweepSegment(Index, Params.Start, Position);
+    }
+    return true;
+}
+
+void UProjectileSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    ProcessImpacts();
+    Compact();
+
+    if (NumLive > 0)
+    {
+        Integrate(DeltaTime);
+        SweepSegments();
+    }
+}
+
+void UProjectileSubsystem::ProcessImpacts()
+{
+    for (int32 i = 0; i < PendingImpacts.Num(); ++i)
+    {
+        const int32 Index = PendingImpactIndices[i];
+        if (bDead[Index])
+        {
+            continue;
+        }
+        bDead[Index] = true;
+
+        const FProjectileImpact& Impact = PendingImpacts[i];
+        if (ICombatDamageable* Damageable = Cast<ICombatDamageable>(Impact.Hit.GetActor()))
+        {
+            Damageable->ApplyDamage(Damage[Index], Impact.Weapon.Get(), Impact.Hit.ImpactPoint, Impact.Velocity.GetSafeNormal() * Impulse[Index]);
+
+            // Confirmation au tireur
+            if (AWeapon* Weapon = Impact.Weapon.Get())
+            {
+                Weapon->OnShotHit.Broadcast(ShotIds[Index], Impact.Hit);
+            }
+        }
+
+        OnProjectileImpact.Broadcast(Impact);
+    }
+
+    PendingImpacts.Reset();
+    PendingImpactIndices.Reset();
+}
+
+void UProjectileSubsystem::Compact()
+{
+    for (int32 Index = NumLive - 1; Index >= 0; --Index)
+    {
+        if (bDead[Index] || Life[Index] <= 0.f)
+        {
+            RemoveAt(Index);
+        }
+    }
+}
+
+void UProjectileSubsystem::RemoveAt(int32 Index)
+{
+    const int32 Last = --NumLive;
+    if (Index != Last)
+    {
+        PosX[Index] = PosX[Last]; PosY[Index] = PosY[Last]; PosZ[Index] = PosZ[Last];
+        PrevX[Index] = PrevX[Last]; PrevY[Index] = PrevY[Last]; PrevZ[Index] = PrevZ[Last];
+        VelX[Index] = VelX[Last]; VelY[Index] = VelY[Last]; VelZ[Index] = VelZ[Last];
+        Gravity[Index] = Gravity[Last];
+        Life[Index] = Life[Last];
+        Damage[Index] = Damage[Last];
+        Impulse[Index] = Impulse[Last];
+        ShotIds[Index] = ShotIds[Last];
+        bDead[Index] = bDead[Last];
+        Weapons[Index] = MoveTemp(Weapons[Last]);
+        Instigators[Index] = MoveTemp(Instigators[Last]);
+    }
+    Weapons[Last].Reset();
+    Instigators[Last].Reset();
+}
+
+void UProjectileSubsystem::Integrate(float DeltaTime)
+{
+    const float GravityZ = GetWorld()->GetGravityZ();
+
+    float* RESTRICT PX = PosX.GetData();
+    float* RESTRICT PY = PosY.GetData();
+    float* RESTRICT PZ = PosZ.GetData();
+    float* RESTRICT OX = PrevX.GetData();
+    float* RESTRICT OY = PrevY.GetData();
+    float* RESTRICT OZ = PrevZ.GetData();
+    float* RESTRICT VX = VelX.GetData();
+    float* RESTRICT VY = VelY.GetData();
+    float* RESTRICT VZ = VelZ.GetData();
+    const float* RESTRICT G = Gravity.GetData();
+    float* RESTRICT L = Life.GetData();
+
+    // Boucle sans branche sur des flux contigus : le compilateur la vectorise
+    for (int32 i = 0; i < NumLive; ++i)
+    {
+        OX[i] = PX[i];
+        OY[i] = PY[i];
+        OZ[i] = PZ[i];
+        VZ[i] += GravityZ * G[i] * DeltaTime;
+        PX[i] += VX[i] * DeltaTime;
+        PY[i] += VY[i] * DeltaTime;
+        PZ[i] += VZ[i] * DeltaTime;
+        L[i] -= DeltaTime;
+    }
+}
+
+void UProjectileSubsystem::SweepSegments()
+{
+    for (int32 Index = 0; Index < NumLive; ++Index)
+    {
+        SweepSegment(Index, FVector(PrevX[Index], PrevY[Index], PrevZ[Index]), FVector(PosX[Index], PosY[Index], PosZ[Index]));
+    }
+}
+
+void UProjectileSubsystem::SweepSegment(int32 Index, const FVector& Start, const FVector& End)
+{
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ProjectileSweep), false);
+    QueryParams.AddIgnoredActor(Instigators[Index].Get());
+    QueryParams.AddIgnoredActor(Weapons[Index].Get());
+
+    GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, Start, End, ECC_Visibility, QueryParams,
+        FCollisionResponseParams::DefaultResponseParam, &TraceDelegate, uint32(Index));
+}
+
+void UProjectileSubsystem::OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+    const int32 Index = int32(Datum.UserData);
+    if (Index >= NumLive)
+    {
+        return;
+    }
+
+    for (const FHitResult& Hit : Datum.OutHits)
+    {
+        if (Hit.bBlockingHit)
+        {
+            FProjectileImpact& Impact = PendingImpacts.AddDefaulted_GetRef();
+            Impact.Weapon = Weapons[Index];
+            Impact.Hit = Hit;
+            Impact.Velocity = FVector(VelX[Index], VelY[Index], VelZ[Index]);
+            PendingImpactIndices.Add(Index);
+            break;
+        }
+    }
+}
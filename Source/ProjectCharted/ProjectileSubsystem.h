@@ -0,0 +1,112 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "ProjectileSubsystem.generated.h"
+
+class AWeapon;
+
+/**
+ * Paramètres de lancement d'un projectile
+ */
+struct FProjectileLaunch
+{
+    TWeakObjectPtr<AWeapon> Weapon;
+    int32 ShotId = INDEX_NONE;
+    TWeakObjectPtr<AActor> Instigator;
+    FVector Start = FVector::ZeroVector;
+    FVector Velocity = FVector::ZeroVector;
+    float GravityScale = 1.f;
+    float Lifetime = 3.f;
+    // Temps déjà écoulé depuis le tir réel (compensation de latence) : le projectile part d'autant plus loin
+    float Age = 0.f;
+    float Damage = 0.f;
+    float Impulse = 0.f;
+};
+
+/**
+ * Impact d'un projectile, diffusé sans créer d'objet
+ */
+struct FProjectileImpact
+{
+    TWeakObjectPtr<AWeapon> Weapon;
+    FHitResult Hit;
+    FVector Velocity = FVector::ZeroVector;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnProjectileImpact, const FProjectileImpact&);
+
+/**
+ * Sous-système de projectiles sans acteur.
+ * Les projectiles vivent dans un pool préalloué en structure de tableaux (SoA) : une seule boucle contiguë
+ * les fait tous avancer, puis chaque segment parcouru est testé en lot par des traces asynchrones.
+ */
+UCLASS()
+class UProjectileSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Lance un projectile ; faux si le pool est plein
+    bool Launch(const FProjectileLaunch& Params);
+
+    int32 GetNumLiveProjectiles() const { return NumLive; }
+
+    // Diffusé à chaque impact (effets visuels / sonores)
+    FOnProjectileImpact OnProjectileImpact;
+
+    // UTickableWorldSubsystem
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    // Taille du pool
+    static constexpr int32 MaxProjectiles = 2048;
+
+    // Applique les impacts reçus depuis la frame précédente
+    void ProcessImpacts();
+
+    // Retire les projectiles morts (échange avec le dernier, aucun décalage)
+    void Compact();
+
+    // Intègre position et vitesse de tous les projectiles vivants
+    void Integrate(float DeltaTime);
+
+    // Lance une trace asynchrone par segment parcouru
+    void SweepSegments();
+
+    // Trace asynchrone d'un segment du projectile Index ; le résultat arrive avant le prochain Compact
+    void SweepSegment(int32 Index, const FVector& Start, const FVector& End);
+
+    void OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+    void RemoveAt(int32 Index);
+
+    // --- Pool SoA ---
+    TArray<float> PosX, PosY, PosZ;
+    TArray<float> PrevX, PrevY, PrevZ;
+    TArray<float> VelX, VelY, VelZ;
+    TArray<float> Gravity;
+    TArray<float> Life;
+    TArray<float> Damage;
+    TArray<float> Impulse;
+    TArray<int32> ShotIds;
+    TArray<bool> bDead;
+    TArray<TWeakObjectPtr<AWeapon>> Weapons;
+    TArray<TWeakObjectPtr<AActor>> Instigators;
+    int32 NumLive = 0;
+
+    // Impacts livrés par les traces, traités au début du tick suivant
+    TArray<FProjectileImpact> PendingImpacts;
+    TArray<int32> PendingImpactIndices;
+
+    FTraceDelegate TraceDelegate;
+};
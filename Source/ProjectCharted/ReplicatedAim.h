@@ -0,0 +1,72 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicatedAim.generated.h"
+
+/**
+ * Visée d'un personnage telle que vue par les autres joueurs.
+ * Tangage et lacet quantifiés sur 16 bits (~0,0055°), visée et épaule sur un bit chacun :
+ * 34 bits par envoi en une seule propriété, sans roulis ni en-têtes séparés pour les deux booléens.
+ */
+USTRUCT()
+struct FReplicatedAim
+{
+    GENERATED_BODY()
+
+    FReplicatedAim() : bAiming(false), bRightShoulder(true) {}
+
+    UPROPERTY()
+    uint16 Pitch = 0;
+
+    UPROPERTY()
+    uint16 Yaw = 0;
+
+    UPROPERTY()
+    uint8 bAiming : 1;
+
+    UPROPERTY()
+    uint8 bRightShoulder : 1;
+
+    void SetRotation(const FRotator& Rotation)
+    {
+        Pitch = FRotator::CompressAxisToShort(Rotation.Pitch);
+        Yaw = FRotator::CompressAxisToShort(Rotation.Yaw);
+    }
+
+    // Rotation décompressée, tangage dans [-180, 180] pour les aim offsets
+    FRotator GetRotation() const
+    {
+        return FRotator(FRotator::NormalizeAxis(FRotator::DecompressAxisFromShort(Pitch)), FRotator::DecompressAxisFromShort(Yaw), 0.f);
+    }
+
+    bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+    {
+        Ar << Pitch;
+        Ar << Yaw;
+
+        uint8 Flags = (bAiming ? 1 : 0) | (bRightShoulder ? 2 : 0);
+        Ar.SerializeBits(&Flags, 2);
+        bAiming = (Flags & 1) != 0;
+        bRightShoulder = (Flags & 2) != 0;
+
+        bOutSuccess = true;
+        return true;
+    }
+
+    bool operator==(const FReplicatedAim& Other) const
+    {
+        return Pitch == Other.Pitch && Yaw == Other.Yaw && bAiming == Other.bAiming && bRightShoulder == Other.bRightShoulder;
+    }
+};
+
+template<>
+struct TStructOpsTypeTraits<FReplicatedAim> : public TStructOpsTypeTraitsBase2<FReplicatedAim>
+{
+    enum
+    {
+        WithNetSerializer = true,
+        WithIdenticalViaEquality = true,
+    };
+};
@@ -0,0 +1,31 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Statistiques des séries de mesures (mode soak, tests de budget par carte)
+ */
+namespace SampleStats
+{
+    inline float Mean(const TArray<float>& Samples)
+    {
+        if (Samples.IsEmpty()) return 0.f;
+
+        double Sum = 0.0;
+        for (float Sample : Samples)
+        {
+            Sum += Sample;
+        }
+        return float(Sum / Samples.Num());
+    }
+
+    // Percentile p (0-1) d'une série triée
+    inline float Percentile(const TArray<float>& Sorted, float P)
+    {
+        if (Sorted.IsEmpty()) return 0.f;
+        const int32 Index = FMath::Clamp(FMath::CeilToInt32(P * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+        return Sorted[Index];
+    }
+}
@@ -0,0 +1,67 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "SoakBotController.h"
+#include "ProjectChartedCharacter.h"
+
+ASoakBotController::ASoakBotController()
+{
+    PrimaryActorTick.bCanEverTick = true;
+    bWantsPlayerState = false;
+}
+
+void ASoakBotController::OnPossess(APawn* InPawn)
+{
+    Super::OnPossess(InPawn);
+
+    // Graine propre à chaque bot, mais reproductible d'une session à l'autre
+    Random.Initialize(GetUniqueID());
+    WanderTimeLeft = 0.f;
+    BurstTimeLeft = Random.FRandRange(0.f, BurstDuration);
+}
+
+void ASoakBotController::OnUnPossess()
+{
+    if (AProjectChartedCharacter* Shooter = Cast<AProjectChartedCharacter>(GetPawn()))
+    {
+        Shooter->DoFireEnd();
+    }
+    bFiring = false;
+
+    Super::OnUnPossess();
+}
+
+void ASoakBotController::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    // N'importe quel pawn se déplace ; seul le personnage du projet tire
+    APawn* Bot = GetPawn();
+    if (!Bot) return;
+    AProjectChartedCharacter* Shooter = Cast<AProjectChartedCharacter>(Bot);
+
+    // Nouvelle direction d'errance ; la visée suit la direction avec un léger tangage
+    WanderTimeLeft -= DeltaTime;
+    if (WanderTimeLeft <= 0.f)
+    {
+        WanderTimeLeft = WanderInterval;
+        WanderDirection = FRotator(0.f, Random.FRandRange(-180.f, 180.f), 0.f).Vector();
+        SetControlRotation(FRotator(Random.FRandRange(-10.f, 10.f), WanderDirection.Rotation().Yaw, 0.f));
+    }
+    Bot->AddMovementInput(WanderDirection);
+
+    // Rafales : la cadence est gérée par le planificateur de tir du personnage
+    BurstTimeLeft -= DeltaTime;
+    if (Shooter && BurstTimeLeft <= 0.f)
+    {
+        bFiring = !bFiring;
+        BurstTimeLeft = bFiring ? BurstDuration : BurstPause;
+        if (bFiring)
+        {
+            Shooter->DoFireStart();
+        }
+        else
+        {
+            Shooter->DoFireEnd();
+        }
+    }
+}
@@ -0,0 +1,45 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AIController.h"
+#include "SoakBotController.generated.h"
+
+/**
+ * Bot du mode soak : erre au hasard et, avec le personnage du projet, tire en rafales en continu.
+ * Aucune navigation ni StateTree : seul le coût du personnage, de l'arme et de la réplication est mesuré.
+ * Les personnages des variantes ne font qu'errer.
+ */
+UCLASS()
+class ASoakBotController : public AAIController
+{
+    GENERATED_BODY()
+
+public:
+    ASoakBotController();
+
+    virtual void Tick(float DeltaTime) override;
+
+protected:
+    virtual void OnPossess(APawn* InPawn) override;
+    virtual void OnUnPossess() override;
+
+    // Durée d'une direction d'errance
+    UPROPERTY(EditAnywhere, Category = "Soak", meta = (ClampMin = 0, Units = "s"))
+    float WanderInterval = 2.f;
+
+    // Durée d'une rafale, puis d'une pause
+    UPROPERTY(EditAnywhere, Category = "Soak", meta = (ClampMin = 0, Units = "s"))
+    float BurstDuration = 1.5f;
+
+    UPROPERTY(EditAnywhere, Category = "Soak", meta = (ClampMin = 0, Units = "s"))
+    float BurstPause = 0.5f;
+
+private:
+    FRandomStream Random;
+    FVector WanderDirection = FVector::ForwardVector;
+    float WanderTimeLeft = 0.f;
+    float BurstTimeLeft = 0.f;
+    bool bFiring = false;
+};
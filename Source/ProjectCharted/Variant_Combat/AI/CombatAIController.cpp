@@ -3,6 +3,7 @@
 
 #include "CombatAIController.h"
 #include "Components/StateTreeAIComponent.h"
+#include "CombatAILODSubsystem.h"
 
 ACombatAIController::ACombatAIController()
 {
@@ -17,3 +18,30 @@ ACombatAIController::ACombatAIController()
 	// this is necessary for EnvQueries to work correctly
 	bAttachToPawn = true;
 }
+
+void ACombatAIController::OnPossess(APawn* InPawn)
+{
+	// set the team before the StateTree starts in the parent call
+	if (const IGenericTeamAgentInterface* TeamAgent = Cast<IGenericTeamAgentInterface>(InPawn))
+	{
+		SetGenericTeamId(TeamAgent->GetGenericTeamId());
+	}
+
+	Super::OnPossess(InPawn);
+
+	// scale the StateTree update rate with the pawn's significance
+	if (UCombatAILODSubsystem* AILOD = GetWorld()->GetSubsystem<UCombatAILODSubsystem>())
+	{
+		AILOD->RegisterController(this);
+	}
+}
+
+void ACombatAIController::OnUnPossess()
+{
+	if (UCombatAILODSubsystem* AILOD = GetWorld()->GetSubsystem<UCombatAILODSubsystem>())
+	{
+		AILOD->UnregisterController(this);
+	}
+
+	Super::OnUnPossess();
+}
@@ -24,4 +24,15 @@ public:
 
 	/** Constructor */
 	ACombatAIController();
+
+	/** Returns the StateTree component */
+	FORCEINLINE UStateTreeAIComponent* GetStateTreeAI() const { return StateTreeAI; }
+
+protected:
+
+	/** Takes the possessed pawn's team so perception agrees with its attacks, and joins the AI LOD scheme */
+	virtual void OnPossess(APawn* InPawn) override;
+
+	/** Leaves the AI LOD scheme */
+	virtual void OnUnPossess() override;
 };
@@ -0,0 +1,176 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "CombatAILODSubsystem.h"
+#include "CombatAIController.h"
+#include "Components/StateTreeAIComponent.h"
+#include "GameFramework/Character.h"
+#include "HAL/IConsoleManager.h"
+#include "SignificanceManager.h"
+#include "Engine/World.h"
+
+namespace CombatAILOD
+{
+	static float GTimeSliceBudgetUs = 1000.0f;
+	static FAutoConsoleVariableRef CVarTimeSliceBudgetUs(
+		TEXT("ai.Combat.TimeSliceBudgetUs"),
+		GTimeSliceBudgetUs,
+		TEXT("Game thread time in microseconds spent each frame on the time-sliced combat AI StateTrees."));
+
+	/** Minimum time between two StateTree updates for each tier. Negative means the tier isn't time-sliced */
+	constexpr float TierIntervals[] =
+	{
+		/* High    */ -1.0f,
+		/* Medium  */ 0.1f,
+		/* Low     */ 0.25f,
+		/* Minimal */ -1.0f,
+	};
+	static_assert(UE_ARRAY_COUNT(TierIntervals) == int32(ECharacterSignificance::Minimal) + 1);
+
+	bool IsTimeSliced(ECharacterSignificance Tier)
+	{
+		return TierIntervals[int32(Tier)] >= 0.0f;
+	}
+}
+
+bool UCombatAILODSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UCombatAILODSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCombatAILODSubsystem, STATGROUP_Tickables);
+}
+
+void UCombatAILODSubsystem::RegisterController(ACombatAIController* Controller)
+{
+	if (!Controller || ManagedAIs.ContainsByPredicate([Controller](const FManagedAI& AI) { return AI.Controller == Controller; }))
+	{
+		return;
+	}
+
+	// start at full rate; the first tick moves it to its actual tier
+	FManagedAI& AI = ManagedAIs.AddDefaulted_GetRef();
+	AI.Controller = Controller;
+}
+
+void UCombatAILODSubsystem::UnregisterController(ACombatAIController* Controller)
+{
+	const int32 Index = ManagedAIs.IndexOfByPredicate([Controller](const FManagedAI& AI) { return AI.Controller == Controller; });
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	// give the StateTree its own tick back
+	ApplyTier(ManagedAIs[Index], ECharacterSignificance::High);
+	ManagedAIs.RemoveAtSwap(Index);
+}
+
+void UCombatAILODSubsystem::Deinitialize()
+{
+	ManagedAIs.Empty();
+	Super::Deinitialize();
+}
+
+ECharacterSignificance UCombatAILODSubsystem::GetAITier(const UProjectChartedSignificanceManager* Significance, const ACharacter* Character)
+{
+	if (!Significance || !Character)
+	{
+		return ECharacterSignificance::High;
+	}
+
+	const ECharacterSignificance Tier = Significance->GetCharacterSignificance(Character);
+	if (Tier != ECharacterSignificance::Minimal)
+	{
+		return Tier;
+	}
+
+	// a dedicated server renders nothing, so only the distance can tell a pawn is out of play there
+	const bool bOutOfSight = Character->GetNetMode() != NM_DedicatedServer && !Character->WasRecentlyRendered(0.25f);
+
+	// visible, close pawns only reach Minimal through the rank caps; keep them thinking at the slowest sliced rate
+	return (bOutOfSight || Significance->IsBeyondLowDistance(Character)) ? ECharacterSignificance::Minimal : ECharacterSignificance::Low;
+}
+
+void UCombatAILODSubsystem::ApplyTier(FManagedAI& AI, ECharacterSignificance Tier)
+{
+	// time spent at full rate or frozen is never replayed; only sliced to sliced moves keep their pending time
+	if (!CombatAILOD::IsTimeSliced(AI.Tier) || !CombatAILOD::IsTimeSliced(Tier))
+	{
+		AI.PendingDeltaTime = 0.0f;
+	}
+
+	AI.Tier = Tier;
+
+	if (ACombatAIController* Controller = AI.Controller.Get())
+	{
+		// full rate ticks through the component; every other tier is driven or frozen by the subsystem
+		Controller->GetStateTreeAI()->SetComponentTickEnabled(Tier == ECharacterSignificance::High);
+	}
+}
+
+void UCombatAILODSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// forget controllers that were destroyed without unpossessing
+	ManagedAIs.RemoveAllSwap([](const FManagedAI& AI) { return !AI.Controller.IsValid(); });
+
+	if (ManagedAIs.IsEmpty())
+	{
+		return;
+	}
+
+	// update the tiers from the character significance
+	const UProjectChartedSignificanceManager* Significance = USignificanceManager::Get<UProjectChartedSignificanceManager>(GetWorld());
+
+	for (FManagedAI& AI : ManagedAIs)
+	{
+		const ACharacter* Character = Cast<ACharacter>(AI.Controller->GetPawn());
+		const ECharacterSignificance Tier = GetAITier(Significance, Character);
+
+		if (Tier != AI.Tier)
+		{
+			ApplyTier(AI, Tier);
+		}
+
+		AI.PendingDeltaTime += DeltaTime;
+	}
+
+	// round-robin the time-sliced tiers until the frame's budget is spent
+	const uint64 BudgetCycles = uint64(CombatAILOD::GTimeSliceBudgetUs / (FPlatformTime::GetSecondsPerCycle64() * 1000000.0));
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	const int32 NumAIs = ManagedAIs.Num();
+	int32 Visited = 0;
+
+	for (; Visited < NumAIs; ++Visited)
+	{
+		// always let at least one AI through so the slices keep moving
+		if (Visited > 0 && FPlatformTime::Cycles64() - StartCycles >= BudgetCycles)
+		{
+			break;
+		}
+
+		FManagedAI& AI = ManagedAIs[(NextSliceIndex + Visited) % NumAIs];
+
+		if (!CombatAILOD::IsTimeSliced(AI.Tier) || AI.PendingDeltaTime < CombatAILOD::TierIntervals[int32(AI.Tier)])
+		{
+			continue;
+		}
+
+		UStateTreeAIComponent* StateTreeAI = AI.Controller->GetStateTreeAI();
+
+		// the component may have turned its own tick back on; keep it under our control
+		StateTreeAI->SetComponentTickEnabled(false);
+
+		// update with all the time elapsed since the previous slice
+		StateTreeAI->TickComponent(AI.PendingDeltaTime, LEVELTICK_All, nullptr);
+		AI.PendingDeltaTime = 0.0f;
+	}
+
+	// the next frame resumes where this one ran out of budget
+	NextSliceIndex = (NextSliceIndex + Visited) % NumAIs;
+}
@@ -0,0 +1,70 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ProjectChartedSignificanceManager.h"
+#include "CombatAILODSubsystem.generated.h"
+
+class ACombatAIController;
+
+/**
+ *  Level of detail for the combat AI logic.
+ *  The tier of each AI comes from its pawn's character significance:
+ *  - High: the StateTree component ticks itself every frame
+ *  - Medium and Low: the component's tick is disabled and this subsystem ticks it at a reduced rate,
+ *    round-robin within a global per-frame budget in microseconds, with the time elapsed since its last update
+ *  - Minimal: the logic is frozen until the pawn becomes significant again, but only for pawns out of sight
+ *    or beyond the Low distance; pawns demoted to Minimal by the significance rank caps keep the slowest sliced rate
+ *  The AI cost per frame stays bounded no matter how many enemies are in the level.
+ */
+UCLASS()
+class UCombatAILODSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Adds an AI controller to the LOD scheme. Called when it possesses a pawn */
+	void RegisterController(ACombatAIController* Controller);
+
+	/** Removes an AI controller from the LOD scheme and restores its StateTree tick */
+	void UnregisterController(ACombatAIController* Controller);
+
+	// ~begin UTickableWorldSubsystem interface
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	// ~end UTickableWorldSubsystem interface
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	/** An AI controller under LOD control */
+	struct FManagedAI
+	{
+		TWeakObjectPtr<ACombatAIController> Controller;
+
+		/** Tier currently applied */
+		ECharacterSignificance Tier = ECharacterSignificance::High;
+
+		/** Game time accumulated since the subsystem last ticked this AI's StateTree */
+		float PendingDeltaTime = 0.0f;
+	};
+
+	/** Tier the AI runs at for its pawn's significance */
+	static ECharacterSignificance GetAITier(const UProjectChartedSignificanceManager* Significance, const ACharacter* Character);
+
+	/** Moves an AI to a new tier, switching its StateTree between self-ticking and time-sliced */
+	static void ApplyTier(FManagedAI& AI, ECharacterSignificance Tier);
+
+	/** Managed AI controllers */
+	TArray<FManagedAI> ManagedAIs;
+
+	/** Index where the next round-robin pass starts */
+	int32 NextSliceIndex = 0;
+};
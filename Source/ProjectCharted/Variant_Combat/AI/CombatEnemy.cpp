@@ -11,6 +11,8 @@
 #include "TimerManager.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Animation/AnimInstance.h"
+#include "ProjectChartedSignificanceManager.h"
+#include "CombatTraceSubsystem.h"
 
 ACombatEnemy::ACombatEnemy()
 {
@@ -59,6 +61,9 @@ void ACombatEnemy::DoAIComboAttack()
 	// reset the attack counter
 	CurrentComboAttack = 0;
 
+	// start a new swing
+	AttackSwing.Begin();
+
 	// play the attack montage
 	if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
 	{
@@ -90,6 +95,9 @@ void ACombatEnemy::DoAIChargedAttack()
 	// reset the charge loop counter
 	CurrentChargeLoop = 0;
 
+	// start a new swing
+	AttackSwing.Begin();
+
 	// play the attack montage
 	if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
 	{
@@ -115,45 +123,65 @@ void ACombatEnemy::AttackMontageEnded(UAnimMontage* Montage, bool bInterrupted)
 
 void ACombatEnemy::DoAttackTrace(FName DamageSourceBone)
 {
-	// sweep for objects in front of the character to be hit by the attack
-	TArray<FHitResult> OutHits;
+	UCombatTraceSubsystem* CombatTraces = GetWorld()->GetSubsystem<UCombatTraceSubsystem>();
+	if (!CombatTraces)
+	{
+		return;
+	}
 
-	// start at the provided socket location, sweep forward
-	const FVector TraceStart = GetMesh()->GetSocketLocation(DamageSourceBone);
-	const FVector TraceEnd = TraceStart + (GetActorForwardVector() * MeleeTraceDistance);
+	// sweep a sphere forward from the provided socket location
+	FCombatTraceRequest Request;
+	Request.Attacker = this;
+	Request.Start = GetMesh()->GetSocketLocation(DamageSourceBone);
+	Request.End = Request.Start + (GetActorForwardVector() * MeleeTraceDistance);
+	Request.Radius = MeleeTraceRadius;
 
 	// enemies only affect Pawn collision objects; they don't knock back boxes
-	FCollisionObjectQueryParams ObjectParams;
-	ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
+	Request.ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
+
+	// only hostile bodies are worth returning
+	Request.IgnoreMask = CombatTeams::GetIgnoreMask(TeamId, true);
 
-	// use a sphere shape for the sweep
-	FCollisionShape CollisionShape;
-	CollisionShape.SetSphere(MeleeTraceRadius);
+	Request.SwingId = AttackSwing.GetId();
 
-	// ignore self
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(this);
+	// also sweep the arc covered by the tip of the attack since the previous notify of this swing, so fast swings don't tunnel
+	const FVector PreviousEnd = AttackSwing.ExchangeTraceEnd(DamageSourceBone, Request.End);
+	if (!PreviousEnd.Equals(Request.End))
+	{
+		FCombatTraceRequest ArcRequest = Request;
+		ArcRequest.Start = PreviousEnd;
+		CombatTraces->QueueAttackTrace(ArcRequest);
+	}
+
+	// the sweeps run with every other attack of the frame; hits come back through ResolveAttackTrace
+	CombatTraces->QueueAttackTrace(Request);
+}
 
-	if (GetWorld()->SweepMultiByObjectType(OutHits, TraceStart, TraceEnd, FQuat::Identity, ObjectParams, CollisionShape, QueryParams))
+void ACombatEnemy::ResolveAttackTrace(const FCombatTraceRequest& Request, const TArray<FHitResult>& Hits)
+{
+	// iterate over each object hit
+	for (const FHitResult& CurrentHit : Hits)
 	{
-		// iterate over each object hit
-		for (const FHitResult& CurrentHit : OutHits)
+		// damage each actor once per swing, however many of its components or notifies hit it, even if the swing has since ended
+		AActor* HitActor = CurrentHit.GetActor();
+		if (!AttackSwing.RegisterHit(Request.SwingId, HitActor))
 		{
-			/** does the actor have the player tag? */
-			if (CurrentHit.GetActor()->ActorHasTag(FName("Player")))
-			{
-				// check if the actor is damageable
-				ICombatDamageable* Damageable = Cast<ICombatDamageable>(CurrentHit.GetActor());
+			continue;
+		}
 
-				if (Damageable)
-				{
-					// knock upwards and away from the impact normal
-					const FVector Impulse = (CurrentHit.ImpactNormal * -MeleeKnockbackImpulse) + (FVector::UpVector * MeleeLaunchImpulse);
+		/** is the actor on a hostile team? */
+		if (CombatTeams::IsHostile(TeamId, CombatTeams::GetTeam(HitActor)))
+		{
+			// check if the actor is damageable
+			ICombatDamageable* Damageable = Cast<ICombatDamageable>(HitActor);
 
-					// pass the damage event to the actor
-					Damageable->ApplyDamage(MeleeDamage, this, CurrentHit.ImpactPoint, Impulse);
+			if (Damageable)
+			{
+				// knock upwards and away from the impact normal
+				const FVector Impulse = (CurrentHit.ImpactNormal * -MeleeKnockbackImpulse) + (FVector::UpVector * MeleeLaunchImpulse);
 
-				}
+				// pass the damage event to the actor
+				Damageable->ApplyDamage(MeleeDamage, this, CurrentHit.ImpactPoint, Impulse);
 			}
 		}
 	}
@@ -172,6 +200,9 @@ void ACombatEnemy::CheckCombo()
 		{
 			AnimInstance->Montage_JumpToSection(ComboSectionNames[CurrentComboAttack], ComboAttackMontage);
 		}
+
+		// each combo section is a new swing that can hit the same actors again
+		AttackSwing.Begin();
 	}
 }
 
@@ -185,6 +216,17 @@ void ACombatEnemy::CheckChargedAttack()
 	{
 		AnimInstance->Montage_JumpToSection(CurrentChargeLoop >= TargetChargeLoops ? ChargeAttackSection : ChargeLoopSection, ChargedAttackMontage);
 	}
+
+	// the released attack is a new swing
+	AttackSwing.Begin();
+}
+
+void ACombatEnemy::SetGenericTeamId(const FGenericTeamId& NewTeamID)
+{
+	TeamId = NewTeamID;
+
+	// tag our bodies so friendly attack sweeps skip them
+	CombatTeams::ApplyMaskFilter(this, TeamId);
 }
 
 void ACombatEnemy::ApplyDamage(float Damage, AActor* DamageCauser, const FVector& DamageLocation, const FVector& DamageImpulse)
@@ -311,12 +353,20 @@ void ACombatEnemy::BeginPlay()
 
 	// fill the life bar
 	LifeBarWidget->SetLifePercentage(1.0f);
+
+	// tag our bodies with our team
+	CombatTeams::ApplyMaskFilter(this, TeamId);
+
+	// scale tick, animation and life bar update rates by significance
+	UProjectChartedSignificanceManager::RegisterCharacter(this);
 }
 
 void ACombatEnemy::EndPlay(EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
 
+	UProjectChartedSignificanceManager::UnregisterCharacter(this);
+
 	// clear the death timer
 	GetWorld()->GetTimerManager().ClearTimer(DeathTimer);
 }
@@ -6,6 +6,8 @@
 #include "GameFramework/Character.h"
 #include "CombatAttacker.h"
 #include "CombatDamageable.h"
+#include "CombatSwing.h"
+#include "CombatTeams.h"
 #include "Animation/AnimMontage.h"
 #include "Engine/TimerHandle.h"
 #include "CombatEnemy.generated.h"
@@ -28,7 +30,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnEnemyDied);
  *  Its bundled AI Controller runs logic through StateTree
  */
 UCLASS(abstract)
-class ACombatEnemy : public ACharacter, public ICombatAttacker, public ICombatDamageable
+class ACombatEnemy : public ACharacter, public ICombatAttacker, public ICombatDamageable, public IGenericTeamAgentInterface
 {
 	GENERATED_BODY()
 
@@ -126,6 +128,13 @@ protected:
 	/** Number of charge animation loop currently playing */
 	int32 CurrentChargeLoop = 0;
 
+	/** Actors damaged and trace positions of the attack swing currently playing, and actors damaged by the previous one */
+	FCombatSwing AttackSwing;
+
+	/** Combat faction of this character. Attacks only damage hostile teams */
+	UPROPERTY(EditAnywhere, Category="Team")
+	FGenericTeamId TeamId = FGenericTeamId(CombatTeams::Enemies);
+
 	/** Time to wait before removing this character from the level after it dies */
 	UPROPERTY(EditAnywhere, Category="Death")
 	float DeathRemovalTime = 5.0f;
@@ -162,9 +171,12 @@ public:
 
 	// ~begin ICombatAttacker interface
 
-	/** Performs an attack's collision check */
+	/** Queues an attack's collision check */
 	virtual void DoAttackTrace(FName DamageSourceBone) override;
 
+	/** Damages the players hit by an attack */
+	virtual void ResolveAttackTrace(const FCombatTraceRequest& Request, const TArray<FHitResult>& Hits) override;
+
 	/** Performs a combo attack's check to continue the string */
 	UFUNCTION(BlueprintCallable, Category="Attacker")
 	virtual void CheckCombo() override;
@@ -188,6 +200,16 @@ public:
 
 	// ~end ICombatDamageable interface
 
+	// ~begin IGenericTeamAgentInterface
+
+	/** Changes the combat faction and updates the collision mask filter of the character's bodies */
+	virtual void SetGenericTeamId(const FGenericTeamId& NewTeamID) override;
+
+	/** Returns the combat faction */
+	virtual FGenericTeamId GetGenericTeamId() const override { return TeamId; }
+
+	// ~end IGenericTeamAgentInterface
+
 protected:
 
 	/** Removes this character from the level after it dies */
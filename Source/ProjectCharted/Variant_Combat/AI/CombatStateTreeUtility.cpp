@@ -8,7 +8,7 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "AIController.h"
 #include "CombatEnemy.h"
-#include "Kismet/GameplayStatics.h"
+#include "PlayerTargetSubsystem.h"
 #include "StateTreeAsyncExecutionContext.h"
 
 bool FStateTreeCharacterGroundedCondition::TestCondition(FStateTreeExecutionContext& Context) const
@@ -266,18 +266,28 @@ EStateTreeRunStatus FStateTreeGetPlayerInfoTask::Tick(FStateTreeExecutionContext
 	// get the instance data
 	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
 
-	// get the character possessed by the first local player
-	InstanceData.TargetPlayerCharacter = Cast<ACharacter>(UGameplayStatics::GetPlayerPawn(InstanceData.Character, 0));
+	const FVector CharacterLocation = InstanceData.Character->GetActorLocation();
+
+	// pick the nearest player from the targets gathered once per frame for every AI
+	const UPlayerTargetSubsystem* PlayerTargets = InstanceData.Character->GetWorld()->GetSubsystem<UPlayerTargetSubsystem>();
+
+	float TargetDistance = 0.0f;
+	const int32 TargetIndex = PlayerTargets ? PlayerTargets->FindNearestTarget(CharacterLocation, UE_BIG_NUMBER, TargetDistance) : INDEX_NONE;
+
+	InstanceData.TargetPlayerCharacter = TargetIndex != INDEX_NONE ? Cast<ACharacter>(PlayerTargets->GetTargetPawn(TargetIndex)) : nullptr;
 
 	// do we have a valid target?
 	if (InstanceData.TargetPlayerCharacter)
 	{
-		// update the last known location
-		InstanceData.TargetPlayerLocation = InstanceData.TargetPlayerCharacter->GetActorLocation();
+		// update the last known location and distance
+		InstanceData.TargetPlayerLocation = PlayerTargets->GetTargetLocation(TargetIndex);
+		InstanceData.DistanceToTarget = TargetDistance;
+	}
+	else
+	{
+		// measure the distance to the last known location
+		InstanceData.DistanceToTarget = FVector::Distance(InstanceData.TargetPlayerLocation, CharacterLocation);
 	}
-
-	// update the distance
-	InstanceData.DistanceToTarget = FVector::Distance(InstanceData.TargetPlayerLocation, InstanceData.Character->GetActorLocation());
 
 	return EStateTreeRunStatus::Running;
 }
@@ -2,17 +2,35 @@
 
 
 #include "EnvQueryContext_Player.h"
-#include "Kismet/GameplayStatics.h"
+#include "PlayerTargetSubsystem.h"
 #include "EnvironmentQuery/EnvQueryTypes.h"
 #include "EnvironmentQuery/Items/EnvQueryItemType_Actor.h"
 #include "GameFramework/Pawn.h"
 
 void UEnvQueryContext_Player::ProvideContext(FEnvQueryInstance& QueryInstance, FEnvQueryContextData& ContextData) const
 {
-	// get the player pawn for the first local player
-	AActor* PlayerPawn = UGameplayStatics::GetPlayerPawn(QueryInstance.Owner.Get(), 0);
-	check(PlayerPawn);
+	// get the querier so we can pick the player nearest to it
+	const AActor* Querier = Cast<AActor>(QueryInstance.Owner.Get());
+	if (!Querier)
+	{
+		return;
+	}
 
-	// add the actor data to the context
-	UEnvQueryItemType_Actor::SetContextHelper(ContextData, PlayerPawn);
+	const UPlayerTargetSubsystem* PlayerTargets = Querier->GetWorld()->GetSubsystem<UPlayerTargetSubsystem>();
+	if (!PlayerTargets)
+	{
+		return;
+	}
+
+	// find the nearest player from the targets gathered once per frame
+	float TargetDistance = 0.0f;
+	const int32 TargetIndex = PlayerTargets->FindNearestTarget(Querier->GetActorLocation(), UE_BIG_NUMBER, TargetDistance);
+
+	const APawn* PlayerPawn = TargetIndex != INDEX_NONE ? PlayerTargets->GetTargetPawn(TargetIndex) : nullptr;
+
+	if (PlayerPawn)
+	{
+		// add the actor data to the context
+		UEnvQueryItemType_Actor::SetContextHelper(ContextData, PlayerPawn);
+	}
 }
@@ -6,6 +6,8 @@
 #include "UObject/Interface.h"
 #include "CombatAttacker.generated.h"
 
+struct FCombatTraceRequest;
+
 /**
  *  CombatAttacker Interface
  *  Provides common functionality to trigger attack animation events.
@@ -26,6 +28,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Attacker")
 	virtual void DoAttackTrace(FName DamageSourceBone) = 0;
 
+	/** Applies the hits of an attack trace queued with UCombatTraceSubsystem. Called at the start of the next frame */
+	virtual void ResolveAttackTrace(const FCombatTraceRequest& Request, const TArray<FHitResult>& Hits) = 0;
+
 	/** Performs a combo attack's check to continue the string. Usually called from a montage's AnimNotify */
 	UFUNCTION(BlueprintCallable, Category="Attacker")
 	virtual void CheckCombo() = 0;
@@ -15,6 +15,8 @@
 #include "TimerManager.h"
 #include "Engine/LocalPlayer.h"
 #include "CombatPlayerController.h"
+#include "ProjectChartedSignificanceManager.h"
+#include "CombatTraceSubsystem.h"
 
 DEFINE_LOG_CATEGORY(LogCombatCharacter);
 
@@ -49,7 +51,7 @@ ACombatCharacter::ACombatCharacter()
 	LifeBar = CreateDefaultSubobject<UWidgetComponent>(TEXT("LifeBar"));
 	LifeBar->SetupAttachment(RootComponent);
 
-	// set the player tag
+	// set the player tag. Kept for Blueprints; damage uses the team instead
 	Tags.Add(FName("Player"));
 }
 
@@ -183,6 +185,9 @@ void ACombatCharacter::ComboAttack()
 	// reset the combo count
 	ComboCount = 0;
 
+	// start a new swing
+	AttackSwing.Begin();
+
 	// play the attack montage
 	if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
 	{
@@ -206,6 +211,9 @@ void ACombatCharacter::ChargedAttack()
 	// reset the charge loop flag
 	bHasLoopedChargedAttack = false;
 
+	// start a new swing
+	AttackSwing.Begin();
+
 	// play the charged attack montage
 	if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
 	{
@@ -244,45 +252,71 @@ void ACombatCharacter::AttackMontageEnded(UAnimMontage* Montage, bool bInterrupt
 
 void ACombatCharacter::DoAttackTrace(FName DamageSourceBone)
 {
-	// sweep for objects in front of the character to be hit by the attack
-	TArray<FHitResult> OutHits;
+	UCombatTraceSubsystem* CombatTraces = GetWorld()->GetSubsystem<UCombatTraceSubsystem>();
+	if (!CombatTraces)
+	{
+		return;
+	}
 
-	// start at the provided socket location, sweep forward
-	const FVector TraceStart = GetMesh()->GetSocketLocation(DamageSourceBone);
-	const FVector TraceEnd = TraceStart + (GetActorForwardVector() * MeleeTraceDistance);
+	// sweep a sphere forward from the provided socket location
+	FCombatTraceRequest Request;
+	Request.Attacker = this;
+	Request.Start = GetMesh()->GetSocketLocation(DamageSourceBone);
+	Request.End = Request.Start + (GetActorForwardVector() * MeleeTraceDistance);
+	Request.Radius = MeleeTraceRadius;
 
 	// check for pawn and world dynamic collision object types
-	FCollisionObjectQueryParams ObjectParams;
-	ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
-	ObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+	Request.ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
+	Request.ObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+
+	// never return friendly bodies
+	Request.IgnoreMask = CombatTeams::GetIgnoreMask(TeamId, false);
+
+	Request.SwingId = AttackSwing.GetId();
 
-	// use a sphere shape for the sweep
-	FCollisionShape CollisionShape;
-	CollisionShape.SetSphere(MeleeTraceRadius);
+	// also sweep the arc covered by the tip of the attack since the previous notify of this swing, so fast swings don't tunnel
+	const FVector PreviousEnd = AttackSwing.ExchangeTraceEnd(DamageSourceBone, Request.End);
+	if (!PreviousEnd.Equals(Request.End))
+	{
+		FCombatTraceRequest ArcRequest = Request;
+		ArcRequest.Start = PreviousEnd;
+		CombatTraces->QueueAttackTrace(ArcRequest);
+	}
 
-	// ignore self
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(this);
+	// the sweeps run with every other attack of the frame; hits come back through ResolveAttackTrace
+	CombatTraces->QueueAttackTrace(Request);
+}
 
-	if (GetWorld()->SweepMultiByObjectType(OutHits, TraceStart, TraceEnd, FQuat::Identity, ObjectParams, CollisionShape, QueryParams))
+void ACombatCharacter::ResolveAttackTrace(const FCombatTraceRequest& Request, const TArray<FHitResult>& Hits)
+{
+	// iterate over each object hit
+	for (const FHitResult& CurrentHit : Hits)
 	{
-		// iterate over each object hit
-		for (const FHitResult& CurrentHit : OutHits)
+		// damage each actor once per swing, however many of its components or notifies hit it, even if the swing has since ended
+		if (!AttackSwing.RegisterHit(Request.SwingId, CurrentHit.GetActor()))
 		{
-			// check if we've hit a damageable actor
-			ICombatDamageable* Damageable = Cast<ICombatDamageable>(CurrentHit.GetActor());
+			continue;
+		}
 
-			if (Damageable)
-			{
-				// knock upwards and away from the impact normal
-				const FVector Impulse = (CurrentHit.ImpactNormal * -MeleeKnockbackImpulse) + (FVector::UpVector * MeleeLaunchImpulse);
+		// skip friendly teams the collision mask couldn't filter out
+		if (CombatTeams::GetAttitude(TeamId, CombatTeams::GetTeam(CurrentHit.GetActor())) == ETeamAttitude::Friendly)
+		{
+			continue;
+		}
 
-				// pass the damage event to the actor
-				Damageable->ApplyDamage(MeleeDamage, this, CurrentHit.ImpactPoint, Impulse);
+		// check if we've hit a damageable actor
+		ICombatDamageable* Damageable = Cast<ICombatDamageable>(CurrentHit.GetActor());
 
-				// call the BP handler to play effects, etc.
-				DealtDamage(MeleeDamage, CurrentHit.ImpactPoint);
-			}
+		if (Damageable)
+		{
+			// knock upwards and away from the impact normal
+			const FVector Impulse = (CurrentHit.ImpactNormal * -MeleeKnockbackImpulse) + (FVector::UpVector * MeleeLaunchImpulse);
+
+			// pass the damage event to the actor
+			Damageable->ApplyDamage(MeleeDamage, this, CurrentHit.ImpactPoint, Impulse);
+
+			// call the BP handler to play effects, etc.
+			DealtDamage(MeleeDamage, CurrentHit.ImpactPoint);
 		}
 	}
 }
@@ -309,6 +343,9 @@ void ACombatCharacter::CheckCombo()
 				{
 					AnimInstance->Montage_JumpToSection(ComboSectionNames[ComboCount], ComboAttackMontage);
 				}
+
+				// each combo section is a new swing that can hit the same actors again
+				AttackSwing.Begin();
 			}
 		}
 	}
@@ -324,6 +361,17 @@ void ACombatCharacter::CheckChargedAttack()
 	{
 		AnimInstance->Montage_JumpToSection(bIsChargingAttack ? ChargeLoopSection : ChargeAttackSection, ChargedAttackMontage);
 	}
+
+	// the released attack is a new swing
+	AttackSwing.Begin();
+}
+
+void ACombatCharacter::SetGenericTeamId(const FGenericTeamId& NewTeamID)
+{
+	TeamId = NewTeamID;
+
+	// tag our bodies so friendly attack sweeps skip them
+	CombatTeams::ApplyMaskFilter(this, TeamId);
 }
 
 void ACombatCharacter::ApplyDamage(float Damage, AActor* DamageCauser, const FVector& DamageLocation, const FVector& DamageImpulse)
@@ -442,12 +490,20 @@ void ACombatCharacter::BeginPlay()
 
 	// reset HP to maximum
 	ResetHP();
+
+	// tag our bodies with our team
+	CombatTeams::ApplyMaskFilter(this, TeamId);
+
+	// scale tick, animation and life bar update rates by significance
+	UProjectChartedSignificanceManager::RegisterCharacter(this);
 }
 
 void ACombatCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
 
+	UProjectChartedSignificanceManager::UnregisterCharacter(this);
+
 	// clear the respawn timer
 	GetWorld()->GetTimerManager().ClearTimer(RespawnTimer);
 }
@@ -6,6 +6,8 @@
 #include "GameFramework/Character.h"
 #include "CombatAttacker.h"
 #include "CombatDamageable.h"
+#include "CombatSwing.h"
+#include "CombatTeams.h"
 #include "Animation/AnimInstance.h"
 #include "CombatCharacter.generated.h"
 
@@ -27,7 +29,7 @@ DECLARE_LOG_CATEGORY_EXTERN(LogCombatCharacter, Log, All);
  *  - Respawning
  */
 UCLASS(abstract)
-class ACombatCharacter : public ACharacter, public ICombatAttacker, public ICombatDamageable
+class ACombatCharacter : public ACharacter, public ICombatAttacker, public ICombatDamageable, public IGenericTeamAgentInterface
 {
 	GENERATED_BODY()
 
@@ -152,6 +154,13 @@ protected:
 	/** If true, the charged attack hold check has been tested at least once */
 	bool bHasLoopedChargedAttack = false;
 
+	/** Actors damaged and trace positions of the attack swing currently playing, and actors damaged by the previous one */
+	FCombatSwing AttackSwing;
+
+	/** Combat faction of this character. Attacks don't damage friendly teams */
+	UPROPERTY(EditAnywhere, Category="Team")
+	FGenericTeamId TeamId = FGenericTeamId(CombatTeams::Players);
+
 	/** Camera boom length while the character is dead */
 	UPROPERTY(EditAnywhere, Category="Camera", meta = (ClampMin = 0, ClampMax = 1000, Units = "cm"))
 	float DeathCameraDistance = 400.0f;
@@ -240,9 +249,12 @@ public:
 
 	// ~begin CombatAttacker interface
 
-	/** Performs the collision check for an attack */
+	/** Queues the collision check for an attack */
 	virtual void DoAttackTrace(FName DamageSourceBone) override;
 
+	/** Damages the actors hit by an attack */
+	virtual void ResolveAttackTrace(const FCombatTraceRequest& Request, const TArray<FHitResult>& Hits) override;
+
 	/** Performs the combo string check */
 	virtual void CheckCombo() override;
 
@@ -264,6 +276,16 @@ public:
 
 	// ~end CombatDamageable interface
 
+	// ~begin IGenericTeamAgentInterface
+
+	/** Changes the combat faction and updates the collision mask filter of the character's bodies */
+	virtual void SetGenericTeamId(const FGenericTeamId& NewTeamID) override;
+
+	/** Returns the combat faction */
+	virtual FGenericTeamId GetGenericTeamId() const override { return TeamId; }
+
+	// ~end IGenericTeamAgentInterface
+
 	/** Called from the respawn timer to destroy and re-create the character */
 	void RespawnCharacter();
 
@@ -2,8 +2,20 @@
 
 
 #include "Variant_Combat/CombatGameMode.h"
+#include "CombatTeams.h"
 
 ACombatGameMode::ACombatGameMode()
 {
 
+}
+
+void ACombatGameMode::InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage)
+{
+	Super::InitGame(MapName, Options, ErrorMessage);
+
+	// start from the players versus enemies matrix; arenas can edit it from here on
+	CombatTeams::ResetAttitudes();
+
+	// perception and other AI team queries use the same matrix as the attack traces
+	FGenericTeamId::SetAttitudeSolver(&CombatTeams::GetAttitude);
 }
\ No newline at end of file
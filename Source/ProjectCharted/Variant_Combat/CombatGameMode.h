@@ -17,4 +17,7 @@ class ACombatGameMode : public AGameModeBase
 public:
 
 	ACombatGameMode();
+
+	/** Restores the default team attitudes and routes AI team queries through them */
+	virtual void InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage) override;
 };
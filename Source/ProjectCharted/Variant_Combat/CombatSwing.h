@@ -0,0 +1,82 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+/**
+ *  Hit registry and swept volume of the current melee swing.
+ *  Remembers the actors already damaged so each one is hit at most once per swing,
+ *  whatever the number of its components overlapped or of trace notifies in the swing,
+ *  and the previous trace end of each source bone so consecutive notifies can sweep the arc in between.
+ *  The registry of the previous swing is kept as well, since traces queued before Begin() resolve after it.
+ *  Storage is inline, so a swing never allocates.
+ */
+struct FCombatSwing
+{
+	/** Starts a new swing, keeping the damaged actors of the ending one for its pending traces and forgetting trace positions */
+	void Begin()
+	{
+		++Id;
+		Swap(DamagedActors, PreviousDamagedActors);
+		DamagedActors.Reset();
+		TraceEnds.Reset();
+	}
+
+	/** Identifies the swing that queued a trace */
+	uint32 GetId() const { return Id; }
+
+	/**
+	 *  Returns true and records the actor if it hasn't been hit during the given swing yet.
+	 *  Hits of swings older than the previous one are dropped, their registry is gone.
+	 */
+	bool RegisterHit(uint32 SwingId, const AActor* Actor)
+	{
+		if (!Actor)
+		{
+			return false;
+		}
+
+		TArray<TObjectKey<AActor>, TInlineAllocator<8>>* Registry =
+			SwingId == Id ? &DamagedActors :
+			SwingId == Id - 1 ? &PreviousDamagedActors :
+			nullptr;
+
+		const TObjectKey<AActor> Key(Actor);
+		if (!Registry || Registry->Contains(Key))
+		{
+			return false;
+		}
+
+		Registry->Add(Key);
+		return true;
+	}
+
+	/** Stores the trace end for the bone and returns the previous one in this swing, or the new one on the first trace */
+	FVector ExchangeTraceEnd(FName Bone, const FVector& TraceEnd)
+	{
+		for (TPair<FName, FVector>& Entry : TraceEnds)
+		{
+			if (Entry.Key == Bone)
+			{
+				const FVector Previous = Entry.Value;
+				Entry.Value = TraceEnd;
+				return Previous;
+			}
+		}
+
+		TraceEnds.Emplace(Bone, TraceEnd);
+		return TraceEnd;
+	}
+
+private:
+
+	uint32 Id = 0;
+
+	TArray<TObjectKey<AActor>, TInlineAllocator<8>> DamagedActors;
+
+	TArray<TObjectKey<AActor>, TInlineAllocator<8>> PreviousDamagedActors;
+
+	TArray<TPair<FName, FVector>, TInlineAllocator<2>> TraceEnds;
+};
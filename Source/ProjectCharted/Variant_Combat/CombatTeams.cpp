@@ -0,0 +1,122 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "CombatTeams.h"
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/Actor.h"
+
+namespace CombatTeams
+{
+	/** Teams that get a collision mask filter bit */
+	constexpr uint8 NumMaskFilterTeams = NumExtraFilterBits;
+
+	/** Row A holds one bit per team that A is hostile to */
+	static uint32 HostileMasks[MaxTeams] = {};
+
+	/** Fills the default matrix on first use */
+	static bool bAttitudesInitialized = false;
+
+	static void EnsureAttitudes()
+	{
+		if (!bAttitudesInitialized)
+		{
+			ResetAttitudes();
+		}
+	}
+}
+
+FGenericTeamId CombatTeams::GetTeam(const AActor* Actor)
+{
+	const IGenericTeamAgentInterface* TeamAgent = Cast<const IGenericTeamAgentInterface>(Actor);
+	return TeamAgent ? TeamAgent->GetGenericTeamId() : FGenericTeamId::NoTeam;
+}
+
+ETeamAttitude::Type CombatTeams::GetAttitude(FGenericTeamId A, FGenericTeamId B)
+{
+	// teams out of the matrix, including NoTeam, don't take sides
+	if (A.GetId() >= MaxTeams || B.GetId() >= MaxTeams)
+	{
+		return ETeamAttitude::Neutral;
+	}
+
+	if (IsHostile(A, B))
+	{
+		return ETeamAttitude::Hostile;
+	}
+
+	return A == B ? ETeamAttitude::Friendly : ETeamAttitude::Neutral;
+}
+
+bool CombatTeams::IsHostile(FGenericTeamId A, FGenericTeamId B)
+{
+	if (A.GetId() >= MaxTeams || B.GetId() >= MaxTeams)
+	{
+		return false;
+	}
+
+	EnsureAttitudes();
+	return (HostileMasks[A.GetId()] & (1u << B.GetId())) != 0;
+}
+
+void CombatTeams::SetHostile(FGenericTeamId A, FGenericTeamId B, bool bHostile)
+{
+	if (!ensure(A.GetId() < MaxTeams && B.GetId() < MaxTeams))
+	{
+		return;
+	}
+
+	EnsureAttitudes();
+
+	if (bHostile)
+	{
+		HostileMasks[A.GetId()] |= 1u << B.GetId();
+	}
+	else
+	{
+		HostileMasks[A.GetId()] &= ~(1u << B.GetId());
+	}
+}
+
+void CombatTeams::ResetAttitudes()
+{
+	FMemory::Memzero(HostileMasks);
+	HostileMasks[Players] = 1u << Enemies;
+	HostileMasks[Enemies] = 1u << Players;
+	bAttitudesInitialized = true;
+}
+
+FMaskFilter CombatTeams::GetMaskFilter(FGenericTeamId Team)
+{
+	return Team.GetId() < NumMaskFilterTeams ? FMaskFilter(1u << Team.GetId()) : FMaskFilter(0);
+}
+
+FMaskFilter CombatTeams::GetIgnoreMask(FGenericTeamId Team, bool bHostileOnly)
+{
+	FMaskFilter IgnoreMask = 0;
+
+	for (uint8 OtherTeam = 0; OtherTeam < NumMaskFilterTeams; ++OtherTeam)
+	{
+		// skip friendly teams, and neutral ones too when only hostile targets matter
+		const ETeamAttitude::Type Attitude = GetAttitude(Team, FGenericTeamId(OtherTeam));
+		if (Attitude == ETeamAttitude::Friendly || (bHostileOnly && Attitude == ETeamAttitude::Neutral))
+		{
+			IgnoreMask |= GetMaskFilter(FGenericTeamId(OtherTeam));
+		}
+	}
+
+	return IgnoreMask;
+}
+
+void CombatTeams::ApplyMaskFilter(AActor* Actor, FGenericTeamId Team)
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	const FMaskFilter MaskFilter = GetMaskFilter(Team);
+	Actor->ForEachComponent<UPrimitiveComponent>(false, [MaskFilter](UPrimitiveComponent* Component)
+	{
+		Component->SetMaskFilterOnBodyInstance(MaskFilter);
+	});
+}
@@ -0,0 +1,53 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GenericTeamAgentInterface.h"
+#include "Engine/EngineTypes.h"
+
+/**
+ *  Combat factions.
+ *  Teams are the engine's FGenericTeamId, carried by actors through IGenericTeamAgentInterface.
+ *  Attitudes come from a hostility matrix stored as one bitmask per team, so a lookup is a shift and a mask.
+ *  By default players and enemies are hostile to each other and every team is friendly to itself;
+ *  arenas with more teams or with friendly fire edit the matrix through SetHostile.
+ *
+ *  The first teams also get a collision mask filter bit on their bodies, so attack sweeps can skip
+ *  the bodies of friendly teams in the physics query itself instead of filtering the hits afterwards.
+ */
+namespace CombatTeams
+{
+	/** Player characters */
+	constexpr uint8 Players = 0;
+
+	/** AI enemies */
+	constexpr uint8 Enemies = 1;
+
+	/** Number of teams the hostility matrix can hold */
+	constexpr uint8 MaxTeams = 32;
+
+	/** Returns the actor's team, or FGenericTeamId::NoTeam if it doesn't have one */
+	FGenericTeamId GetTeam(const AActor* Actor);
+
+	/** Returns the attitude of team A towards team B. Actors without a team are neutral to everyone */
+	ETeamAttitude::Type GetAttitude(FGenericTeamId A, FGenericTeamId B);
+
+	/** Returns true if team A is hostile to team B */
+	bool IsHostile(FGenericTeamId A, FGenericTeamId B);
+
+	/** Makes team A hostile to team B or not. Making a team hostile to itself enables friendly fire */
+	void SetHostile(FGenericTeamId A, FGenericTeamId B, bool bHostile);
+
+	/** Restores the default players versus enemies matrix */
+	void ResetAttitudes();
+
+	/** Returns the collision mask filter bit of the team's bodies, or 0 if the team has none */
+	FMaskFilter GetMaskFilter(FGenericTeamId Team);
+
+	/** Returns the mask filter bits of the teams whose bodies the team's attacks never need to hit */
+	FMaskFilter GetIgnoreMask(FGenericTeamId Team, bool bHostileOnly);
+
+	/** Tags all of the actor's primitive components with the team's collision mask filter */
+	void ApplyMaskFilter(AActor* Actor, FGenericTeamId Team);
+}
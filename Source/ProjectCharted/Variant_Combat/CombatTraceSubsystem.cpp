@@ -0,0 +1,96 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "CombatTraceSubsystem.h"
+#include "CombatAttacker.h"
+#include "Engine/World.h"
+
+namespace CombatTraceSubsystem
+{
+	/** The high bit of the trace user data selects the batch, the rest is the request index */
+	constexpr uint32 BatchBit = 1u << 31;
+}
+
+void UCombatTraceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	TraceDelegate.BindUObject(this, &UCombatTraceSubsystem::OnTraceCompleted);
+}
+
+void UCombatTraceSubsystem::Deinitialize()
+{
+	TraceDelegate.Unbind();
+	Batches[0].Empty();
+	Batches[1].Empty();
+	Super::Deinitialize();
+}
+
+bool UCombatTraceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UCombatTraceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCombatTraceSubsystem, STATGROUP_Tickables);
+}
+
+void UCombatTraceSubsystem::QueueAttackTrace(const FCombatTraceRequest& Request)
+{
+	Batches[WriteBatch].Add(Request);
+}
+
+void UCombatTraceSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+	FlushBatch();
+}
+
+void UCombatTraceSubsystem::FlushBatch()
+{
+	TArray<FCombatTraceRequest>& Batch = Batches[WriteBatch];
+	if (Batch.Num() > 0)
+	{
+		UWorld* World = GetWorld();
+		const uint32 BatchFlag = WriteBatch ? CombatTraceSubsystem::BatchBit : 0u;
+
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(CombatTraceBatch), false);
+
+		for (int32 RequestIndex = 0; RequestIndex < Batch.Num(); ++RequestIndex)
+		{
+			const FCombatTraceRequest& Request = Batch[RequestIndex];
+
+			// ignore the attacker
+			QueryParams.ClearIgnoredActors();
+			QueryParams.AddIgnoredActor(Request.Attacker.Get());
+
+			// friendly bodies are filtered out by the physics query itself
+			QueryParams.IgnoreMask = Request.IgnoreMask;
+
+			World->AsyncSweepByObjectType(EAsyncTraceType::Multi, Request.Start, Request.End, FQuat::Identity, Request.ObjectParams,
+				FCollisionShape::MakeSphere(Request.Radius), QueryParams, &TraceDelegate, BatchFlag | uint32(RequestIndex));
+		}
+	}
+
+	// the previous batch's results were delivered at the start of this frame, so it can be reused
+	WriteBatch ^= 1;
+	Batches[WriteBatch].Reset();
+}
+
+void UCombatTraceSubsystem::OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	const int32 BatchIndex = (Datum.UserData & CombatTraceSubsystem::BatchBit) ? 1 : 0;
+	const int32 RequestIndex = int32(Datum.UserData & ~CombatTraceSubsystem::BatchBit);
+
+	const TArray<FCombatTraceRequest>& Batch = Batches[BatchIndex];
+	if (!Batch.IsValidIndex(RequestIndex))
+	{
+		return;
+	}
+
+	// the attacker may have been destroyed while the sweep was in flight
+	if (ICombatAttacker* Attacker = Cast<ICombatAttacker>(Batch[RequestIndex].Attacker.Get()))
+	{
+		Attacker->ResolveAttackTrace(Batch[RequestIndex], Datum.OutHits);
+	}
+}
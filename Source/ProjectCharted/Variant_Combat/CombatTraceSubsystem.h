@@ -0,0 +1,78 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "CombatTraceSubsystem.generated.h"
+
+/**
+ *  A melee attack trace waiting to be resolved
+ */
+struct FCombatTraceRequest
+{
+	/** Attacker that receives the hits. Must implement ICombatAttacker */
+	TWeakObjectPtr<AActor> Attacker;
+
+	/** Sweep start and end */
+	FVector Start = FVector::ZeroVector;
+	FVector End = FVector::ZeroVector;
+
+	/** Radius of the swept sphere */
+	float Radius = 0.0f;
+
+	/** Object types the attack can hit */
+	FCollisionObjectQueryParams ObjectParams;
+
+	/** Mask filter bits of the bodies the sweep skips, usually the attacker's friendly teams */
+	FMaskFilter IgnoreMask = 0;
+
+	/** Swing that queued the trace, so hits can be de-duplicated per swing */
+	uint32 SwingId = 0;
+};
+
+/**
+ *  Collects the melee attack traces requested by every attacker during the frame
+ *  and runs them as one batch of async sphere sweeps.
+ *  Results are handed back to each attacker's ResolveAttackTrace at the start of the next frame,
+ *  so damage is applied at a fixed point in the frame instead of during animation updates.
+ */
+UCLASS()
+class UCombatTraceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Adds an attack trace to the current frame's batch */
+	void QueueAttackTrace(const FCombatTraceRequest& Request);
+
+	/** Returns the number of traces waiting for the current frame's batch */
+	int32 GetNumQueuedTraces() const { return Batches[WriteBatch].Num(); }
+
+	// ~begin UTickableWorldSubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	// ~end UTickableWorldSubsystem interface
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	/** Starts the async sweeps for the whole current batch */
+	void FlushBatch();
+
+	/** Called by the engine at the start of the next frame once the sweep is done */
+	void OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+	/** Double buffer: one batch fills up while the other waits for its results */
+	TArray<FCombatTraceRequest> Batches[2];
+	int32 WriteBatch = 0;
+
+	FTraceDelegate TraceDelegate;
+};
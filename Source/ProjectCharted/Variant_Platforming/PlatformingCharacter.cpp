@@ -12,6 +12,7 @@
 #include "EnhancedInputComponent.h"
 #include "TimerManager.h"
 #include "Engine/LocalPlayer.h"
+#include "ProjectChartedSignificanceManager.h"
 
 APlatformingCharacter::APlatformingCharacter()
 {
@@ -295,10 +296,20 @@ bool APlatformingCharacter::HasWallJumped() const
 	return bHasWallJumped;
 }
 
+void APlatformingCharacter::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// scale tick and animation update rates by significance
+	UProjectChartedSignificanceManager::RegisterCharacter(this);
+}
+
 void APlatformingCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
 
+	UProjectChartedSignificanceManager::UnregisterCharacter(this);
+
 	// clear the wall jump reset timer
 	GetWorld()->GetTimerManager().ClearTimer(WallJumpTimer);
 }
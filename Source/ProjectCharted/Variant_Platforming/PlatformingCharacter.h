@@ -127,6 +127,9 @@ public:
 
 public:	
 	
+	/** Gameplay initialization */
+	virtual void BeginPlay() override;
+
 	/** EndPlay cleanup */
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
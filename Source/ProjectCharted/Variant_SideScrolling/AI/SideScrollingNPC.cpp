@@ -4,6 +4,7 @@
 #include "SideScrollingNPC.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "TimerManager.h"
+#include "ProjectChartedSignificanceManager.h"
 
 ASideScrollingNPC::ASideScrollingNPC()
 {
@@ -12,10 +13,20 @@ ASideScrollingNPC::ASideScrollingNPC()
 	GetCharacterMovement()->MaxWalkSpeed = 150.0f;
 }
 
+void ASideScrollingNPC::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// scale tick and animation update rates by significance
+	UProjectChartedSignificanceManager::RegisterCharacter(this);
+}
+
 void ASideScrollingNPC::EndPlay(EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
 
+	UProjectChartedSignificanceManager::UnregisterCharacter(this);
+
 	// clear the deactivation timer
 	GetWorld()->GetTimerManager().ClearTimer(DeactivationTimer);
 }
@@ -5,20 +5,33 @@
 #include "StateTreeExecutionContext.h"
 #include "StateTreeExecutionTypes.h"
 #include "AIController.h"
-#include "Kismet/GameplayStatics.h"
+#include "PlayerTargetSubsystem.h"
 
 EStateTreeRunStatus FStateTreeGetPlayerTask::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
 {
 	// get the instance data
 	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
 
-	// set the player pawn as the target
-	InstanceData.TargetPlayer = UGameplayStatics::GetPlayerPawn(InstanceData.Controller.Get(), 0);
+	InstanceData.TargetPlayer = nullptr;
+	InstanceData.bValidTarget = false;
 
-	// are the NPC and target valid?
-	if (IsValid(InstanceData.TargetPlayer) && IsValid(InstanceData.NPC))
+	// is the NPC valid?
+	if (IsValid(InstanceData.NPC))
 	{
-		InstanceData.bValidTarget = FVector::Distance(InstanceData.NPC->GetActorLocation(), InstanceData.TargetPlayer->GetActorLocation()) < InstanceData.RangeMax;
+		// target the nearest player, from the targets gathered once per frame for every AI
+		if (const UPlayerTargetSubsystem* PlayerTargets = InstanceData.NPC->GetWorld()->GetSubsystem<UPlayerTargetSubsystem>())
+		{
+			float TargetDistance = 0.0f;
+			const int32 TargetIndex = PlayerTargets->FindNearestTarget(InstanceData.NPC->GetActorLocation(), UE_BIG_NUMBER, TargetDistance);
+
+			if (TargetIndex != INDEX_NONE)
+			{
+				InstanceData.TargetPlayer = PlayerTargets->GetTargetPawn(TargetIndex);
+
+				// the target is only valid while in range
+				InstanceData.bValidTarget = IsValid(InstanceData.TargetPlayer) && TargetDistance < InstanceData.RangeMax;
+			}
+		}
 	}
 
 	return EStateTreeRunStatus::Running;
@@ -13,6 +13,7 @@
 #include "SideScrollingInteractable.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "TimerManager.h"
+#include "ProjectChartedSignificanceManager.h"
 
 ASideScrollingCharacter::ASideScrollingCharacter()
 {
@@ -59,10 +60,20 @@ ASideScrollingCharacter::ASideScrollingCharacter()
 	JumpMaxCount = 2;
 }
 
+void ASideScrollingCharacter::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// scale tick and animation update rates by significance
+	UProjectChartedSignificanceManager::RegisterCharacter(this);
+}
+
 void ASideScrollingCharacter::EndPlay(EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
 
+	UProjectChartedSignificanceManager::UnregisterCharacter(this);
+
 	// clear the wall jump timer
 	GetWorld()->GetTimerManager().ClearTimer(WallJumpTimer);
 }
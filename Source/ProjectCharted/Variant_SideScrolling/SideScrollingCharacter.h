@@ -97,6 +97,9 @@ public:
 
 protected:
 
+	/** Gameplay initialization */
+	virtual void BeginPlay() override;
+
 	/** Gameplay cleanup */
 	virtual void EndPlay(EEndPlayReason::Type EndPlayReason) override;
 
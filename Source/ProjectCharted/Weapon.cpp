@@ -1,37 +1,415 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Weapon.h"
+#include "HitscanSubsystem.h"
+#include "ProjectileSubsystem.h"
+#include "WeaponPickupSubsystem.h"
+#include "NetBandwidthProfiler.h"
+#include "ProjectChartedCharacter.h"
+#include "WeaponFireScheduler.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+#include "Engine/AssetManager.h"
 #include "Net/UnrealNetwork.h"
-#include "UObject/ConstructorHelpers.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Engine/SkeletalMesh.h"
+#include "Components/SkeletalMeshComponent.h"
+
+FOnWeaponOwnerChanged AWeapon::OnOwnerChanged;
 
 AWeapon::AWeapon()
 {
     PrimaryActorTick.bCanEverTick = false;
     bReplicates = true;
-    SetReplicateMovement(true);
+
+    // L'arme est rigidement attachée à un socket : les clients la rattachent eux-mêmes
+    // à partir du CurrentWeapon répliqué du porteur, le mouvement n'est donc pas répliqué
+    SetReplicateMovement(false);
 
     WeaponMesh = CreateDefaultSubobject<USkeletalMeshComponent>(TEXT("WeaponMesh"));
     RootComponent = WeaponMesh;
-    WeaponMesh->SetIsReplicated(true);
+    WeaponMesh->SetIsReplicated(false);
+
+    // Pertinence réseau héritée du porteur : une arme rangée dans le pool garde son canal ouvert
+    bNetUseOwnerRelevancy = true;
+
+    // Dormante tant qu'elle est tenue : le serveur ne compare plus ses propriétés à chaque tick réseau
+    NetDormancy = DORM_DormantAll;
+
+    // Mesh par défaut (AK47) : simple chemin, chargé au BeginPlay
+    DefaultMesh = TSoftObjectPtr<USkeletalMesh>(FSoftObjectPath(TEXT("/Game/Weapons/AK47Subdiv.AK47Subdiv")));
+
+    Damage = Stats.Damage;
+}
+
+void AWeapon::PostInitializeComponents()
+{
+    Super::PostInitializeComponents();
+
+    // Les statistiques de la définition remplacent les valeurs par défaut avant la première réplication
+    if (Definition)
+    {
+        Stats = Definition->Stats;
+        MuzzleSocketName = Definition->MuzzleSocketName;
+    }
+    Damage = Stats.Damage;
+
+    if (HasAuthority())
+    {
+        SpreadSeed = FMath::Rand();
+    }
+}
 
-    // Chargement automatique du mesh
-    static ConstructorHelpers::FObjectFinder<USkeletalMesh> MeshObj(TEXT("/Game/Weapons/AK47Subdiv.AK47Subdiv"));
-    if (MeshObj.Succeeded())
+void AWeapon::OnSerializeNewActor(FOutBunch& OutBunch)
+{
+    Super::OnSerializeNewActor(OutBunch);
+
+    // État initial : envoyé à l'ouverture de chaque canal, jamais modifié ensuite
+    NET_BANDWIDTH_RECORD_PROPERTY(AWeapon, Damage, this);
+    NET_BANDWIDTH_RECORD_PROPERTY(AWeapon, SpreadSeed, this);
+}
+
+void AWeapon::BeginPlay()
+{
+    Super::BeginPlay();
+
+    // Arme posée dans le niveau sans porteur : ramassable
+    if (HasAuthority() && !GetOwner())
     {
-        WeaponMesh->SetSkeletalMesh(MeshObj.Object);
+        if (UWeaponPickupSubsystem* Pickups = GetWorld()->GetSubsystem<UWeaponPickupSubsystem>())
+        {
+            Pickups->RegisterPickup(this);
+        }
     }
 
-    Damage = 20.0f;
+    const TSoftObjectPtr<USkeletalMesh>& MeshToLoad = GetMeshToLoad();
+    if (MeshToLoad.IsNull()) return;
+
+    // Mesh déjà en mémoire (préchargé par l'état de jeu) : affectation immédiate, sinon chargement asynchrone
+    if (MeshToLoad.IsValid())
+    {
+        OnMeshLoaded();
+    }
+    else
+    {
+        MeshLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+            MeshToLoad.ToSoftObjectPath(), FStreamableDelegate::CreateUObject(this, &AWeapon::OnMeshLoaded));
+    }
+}
+
+void AWeapon::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (MeshLoadHandle.IsValid())
+    {
+        MeshLoadHandle->CancelHandle();
+        MeshLoadHandle.Reset();
+    }
+
+    if (UWeaponPickupSubsystem* Pickups = GetWorld()->GetSubsystem<UWeaponPickupSubsystem>())
+    {
+        Pickups->UnregisterPickup(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+const TSoftObjectPtr<USkeletalMesh>& AWeapon::GetMeshToLoad() const
+{
+    return Definition && !Definition->Mesh.IsNull() ? Definition->Mesh : DefaultMesh;
+}
+
+void AWeapon::OnMeshLoaded()
+{
+    if (USkeletalMesh* Mesh = GetMeshToLoad().Get())
+    {
+        WeaponMesh->SetSkeletalMesh(Mesh);
+    }
+}
+
+// --- Noyaux de tir ---
+// Un noyau par mode de tir, choisi une seule fois par salve : la boucle de chaque noyau ne teste jamais le mode
+namespace WeaponFire
+{
+    struct FContext
+    {
+        AWeapon* Weapon;
+        APawn* Instigator;
+        const FWeaponStats& Stats;
+        FVector Start;
+        FVector Direction;
+        float SpreadAngle;
+        int32 FirstShotIndex;
+        float FirstShotAge;
+        double RewindTime;
+    };
+
+    FORCEINLINE FHitscanShot MakeHitscanShot(const FContext& Context, int32 ShotId, const FVector& Direction, float Damage)
+    {
+        FHitscanShot Shot;
+        Shot.Weapon = Context.Weapon;
+        Shot.ShotId = ShotId;
+        Shot.Instigator = Context.Instigator;
+        Shot.Start = Context.Start;
+        Shot.Direction = Direction;
+        Shot.Range = Context.Stats.Range;
+        Shot.Damage = Damage;
+        Shot.Impulse = Context.Stats.HitImpulse;
+        Shot.FalloffStart = Context.Stats.FalloffStart;
+        Shot.FalloffEnd = Context.Stats.FalloffEnd;
+        Shot.MinDamageMultiplier = Context.Stats.MinDamageMultiplier;
+        Shot.PenetrationsLeft = Context.Stats.MaxPenetrations;
+        Shot.PenetrationDamageMultiplier = Context.Stats.PenetrationDamageMultiplier;
+        Shot.RewindTime = Context.RewindTime;
+        return Shot;
+    }
+
+    template<EWeaponFireMode Mode>
+    struct TKernel;
+
+    template<>
+    struct TKernel<EWeaponFireMode::Hitscan>
+    {
+        static void Fire(const FContext& Context, int32 NumShots)
+        {
+            UHitscanSubsystem* Hitscan = Context.Weapon->GetWorld()->GetSubsystem<UHitscanSubsystem>();
+            if (!Hitscan) return;
+
+            for (int32 i = 0; i < NumShots; ++i)
+            {
+                const FVector Direction = Context.Weapon->GetSpreadDirection(Context.Direction, Context.SpreadAngle, Context.FirstShotIndex + i, 0);
+                Hitscan->QueueShot(MakeHitscanShot(Context, Context.FirstShotIndex + i, Direction, Context.Stats.Damage));
+            }
+        }
+    };
+
+    template<>
+    struct TKernel<EWeaponFireMode::Pellets>
+    {
+        static void Fire(const FContext& Context, int32 NumShots)
+        {
+            UHitscanSubsystem* Hitscan = Context.Weapon->GetWorld()->GetSubsystem<UHitscanSubsystem>();
+            if (!Hitscan) return;
+
+            // Les dégâts du tir sont répartis entre les plombs
+            const int32 PelletCount = FMath::Max<int32>(Context.Stats.PelletCount, 1);
+            const float PelletDamage = Context.Stats.Damage / PelletCount;
+            for (int32 i = 0; i < NumShots; ++i)
+            {
+                for (int32 Pellet = 0; Pellet < PelletCount; ++Pellet)
+                {
+                    const FVector Direction = Context.Weapon->GetSpreadDirection(Context.Direction, Context.SpreadAngle, Context.FirstShotIndex + i, Pellet);
+                    Hitscan->QueueShot(MakeHitscanShot(Context, Context.FirstShotIndex + i, Direction, PelletDamage));
+                }
+            }
+        }
+    };
+
+    template<>
+    struct TKernel<EWeaponFireMode::Projectile>
+    {
+        static void Fire(const FContext& Context, int32 NumShots)
+        {
+            UProjectileSubsystem* Projectiles = Context.Weapon->GetWorld()->GetSubsystem<UProjectileSubsystem>();
+            if (!Projectiles) return;
+
+            FProjectileLaunch Launch;
+            Launch.Weapon = Context.Weapon;
+            Launch.Instigator = Context.Instigator;
+            Launch.Start = Context.Start;
+            Launch.GravityScale = Context.Stats.ProjectileGravityScale;
+            Launch.Lifetime = Context.Stats.ProjectileLifetime;
+            Launch.Damage = Context.Stats.Damage;
+            Launch.Impulse = Context.Stats.HitImpulse;
+            const float Interval = Context.Stats.GetFireInterval();
+            for (int32 i = 0; i < NumShots; ++i)
+            {
+                // Le sous-système avance le projectile du temps écoulé depuis son instant de tir réel
+                Launch.Age = FMath::Max(Context.FirstShotAge - i * Interval, 0.f);
+                Launch.Velocity = Context.Weapon->GetSpreadDirection(Context.Direction, Context.SpreadAngle, Context.FirstShotIndex + i, 0) * Context.Stats.ProjectileSpeed;
+                Launch.ShotId = Context.FirstShotIndex + i;
+                Projectiles->Launch(Launch);
+            }
+        }
+    };
 }
 
 void AWeapon::Fire()
 {
-    // Logique de tir  complter (raycast, spawn projectile, etc.)
+    FireShots(1);
+}
+
+void AWeapon::FireShots(int32 NumShots, float FirstShotAge, double RewindTime)
+{
+    // Le serveur fait autorité sur les tirs
+    if (!HasAuthority() || NumShots <= 0) return;
+
+    FVector Start, Direction;
+    GetShotOriginAndDirection(Start, Direction);
+
+    const WeaponFire::FContext Context{ this, GetInstigator(), Stats, Start, Direction, GetSpreadAngle(), ShotCounter, FirstShotAge, RewindTime };
+    ShotCounter += NumShots;
+    LastFireTime = GetWorld()->GetTimeSeconds();
+
+    switch (Stats.FireMode)
+    {
+    case EWeaponFireMode::Hitscan:
+        WeaponFire::TKernel<EWeaponFireMode::Hitscan>::Fire(Context, NumShots);
+        break;
+    case EWeaponFireMode::Pellets:
+        WeaponFire::TKernel<EWeaponFireMode::Pellets>::Fire(Context, NumShots);
+        break;
+    case EWeaponFireMode::Projectile:
+        WeaponFire::TKernel<EWeaponFireMode::Projectile>::Fire(Context, NumShots);
+        break;
+    }
+}
+
+bool AWeapon::CanFireClientShots(int32 FirstShotIndex, int32 NumShots) const
+{
+    // Une salve ne traverse jamais un rechargement
+    if (NumShots > Stats.GetRoundsInMagazine(FirstShotIndex))
+    {
+        return false;
+    }
+
+    // Salve dans un chargeur plus récent que le dernier tir du serveur : le rechargement a commencé
+    // au plus tôt à cette salve et doit être terminé (marge pour la gigue réseau)
+    const int32 Size = FMath::Max(Stats.MagazineSize, 1);
+    const bool bNewMagazine = ShotCounter > 0 && FirstShotIndex / Size > (ShotCounter - 1) / Size;
+    return !bNewMagazine || GetWorld()->GetTimeSeconds() >= LastFireTime + Stats.ReloadTime * 0.8f;
+}
+
+bool AWeapon::ConsumeFireCredit(int32 NumShots, int64 SkippedShots)
+{
+    // Le crédit se regagne un peu plus vite que la cadence pour absorber les écarts d'horloge du client
+    constexpr float RateTolerance = 1.1f;
+
+    const double Now = GetWorld()->GetTimeSeconds();
+    const float Regained = float((Now - FireCreditTime) / Stats.GetFireInterval()) * RateTolerance;
+    FireCredit = FMath::Min(FireCredit + Regained, float(FWeaponFireScheduler::MaxShotsPerAdvance));
+    FireCreditTime = Now;
+
+    if (NumShots > FireCredit)
+    {
+        return false;
+    }
+
+    // Les tirs sautés vident le crédit restant sans jamais faire refuser la salve : un trou plus grand
+    // que le crédit (RPC non fiables perdus) bloquerait sinon toutes les salves suivantes
+    FireCredit -= float(NumShots);
+    FireCredit -= FMath::Min(float(SkippedShots), FireCredit);
+    return true;
+}
+
+float AWeapon::GetSpreadAngle() const
+{
+    // La visée vient du composant de mouvement : même valeur sur le client et le serveur
+    const AProjectChartedCharacter* Character = Cast<AProjectChartedCharacter>(GetInstigator());
+    return Character && Character->IsAiming() ? Stats.SpreadAngle * Stats.AimSpreadMultiplier : Stats.SpreadAngle;
+}
+
+FVector AWeapon::GetSpreadDirection(const FVector& AimDirection, float SpreadAngle, int32 ShotIndex, int32 PelletIndex) const
+{
+    // Flux pseudo-aléatoire propre à chaque plomb : aucune direction n'a besoin d'être répliquée
+    FRandomStream Stream(int32(HashCombineFast(HashCombineFast(uint32(SpreadSeed), uint32(ShotIndex)), uint32(PelletIndex))));
+    return Stream.VRandCone(AimDirection, FMath::DegreesToRadians(SpreadAngle));
+}
+
+bool AWeapon::PredictShot(int32 ShotIndex, int32 PelletIndex, FHitResult& OutHit) const
+{
+    FVector Start, Direction;
+    GetShotOriginAndDirection(Start, Direction);
+    Direction = GetSpreadDirection(Direction, GetSpreadAngle(), ShotIndex, PelletIndex);
+
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(WeaponPredictShot), true);
+    QueryParams.AddIgnoredActor(this);
+    QueryParams.AddIgnoredActor(GetInstigator());
+
+    const FVector End = Start + Direction * Stats.Range;
+    if (!GetWorld()->LineTraceSingleByChannel(OutHit, Start, End, ECC_Visibility, QueryParams))
+    {
+        OutHit.ImpactPoint = OutHit.TraceEnd = End;
+        return false;
+    }
+    return true;
+}
+
+FRotator AWeapon::GetRecoilKick(int32 ShotIndex) const
+{
+    FRandomStream Stream(int32(HashCombineFast(uint32(SpreadSeed), ~uint32(ShotIndex))));
+    return FRotator(Stats.RecoilPitch, Stream.FRandRange(-Stats.RecoilYaw, Stats.RecoilYaw), 0.f);
+}
+
+void AWeapon::GetShotOriginAndDirection(FVector& OutStart, FVector& OutDirection) const
+{
+    // Point de vue du porteur (rotation de contrôle), sinon orientation du canon
+    if (const APawn* OwnerPawn = GetInstigator())
+    {
+        FRotator EyeRotation;
+        OwnerPawn->GetActorEyesViewPoint(OutStart, EyeRotation);
+        OutDirection = EyeRotation.Vector();
+        return;
+    }
+
+    const FTransform Muzzle = WeaponMesh->DoesSocketExist(MuzzleSocketName)
+        ? WeaponMesh->GetSocketTransform(MuzzleSocketName)
+        : GetActorTransform();
+    OutStart = Muzzle.GetLocation();
+    OutDirection = Muzzle.GetRotation().GetForwardVector();
+}
+
+void AWeapon::ActivateForOwner(APawn* NewOwner)
+{
+    // Réveiller l'arme le temps de répliquer son nouvel état
+    FlushNetDormancy();
+
+    // Une arme tenue n'est plus ramassable
+    if (UWeaponPickupSubsystem* Pickups = GetWorld()->GetSubsystem<UWeaponPickupSubsystem>())
+    {
+        Pickups->UnregisterPickup(this);
+    }
+
+    if (GetOwner() != NewOwner)
+    {
+        SetOwner(NewOwner);
+        SetInstigator(NewOwner);
+    }
+    SetActorHiddenInGame(false);
+
+    // Nouveau porteur : le client repart lui aussi de zéro (OnRep_CurrentWeapon), chargeur plein
+    ShotCounter = 0;
+    LastFireTime = 0.0;
+    FireCredit = float(FWeaponFireScheduler::MaxShotsPerAdvance);
+    FireCreditTime = GetWorld()->GetTimeSeconds();
+}
+
+void AWeapon::SetOwner(AActor* NewOwner)
+{
+    AActor* OldOwner = GetOwner();
+    Super::SetOwner(NewOwner);
+
+    if (OldOwner != NewOwner)
+    {
+        OnOwnerChanged.Broadcast(this, OldOwner, NewOwner);
+    }
+}
+
+void AWeapon::Deactivate()
+{
+    FlushNetDormancy();
+    SetActorHiddenInGame(true);
+    SetActorEnableCollision(false);
+    DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
 }
 
 void AWeapon::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-    DOREPLIFETIME(AWeapon, Damage);
+
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+    DOREPLIFETIME_WITH_PARAMS_FAST(AWeapon, Damage, Params);
+
+    Params.Condition = COND_InitialOnly;
+    DOREPLIFETIME_WITH_PARAMS_FAST(AWeapon, SpreadSeed, Params);
 }
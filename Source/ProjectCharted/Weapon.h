@@ -5,10 +5,18 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Net/UnrealNetwork.h"
+#include "WeaponDefinition.h"
+#include "Engine/StreamableManager.h"
 #include "Weapon.generated.h"
 
+// Tir confirmé par le serveur (identifiant du tir, impact)
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnWeaponShotHit, int32 /*ShotId*/, const FHitResult& /*Hit*/);
+
+// Changement de porteur d'une arme (réacheminement dans le graphe de réplication)
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnWeaponOwnerChanged, AWeapon* /*Weapon*/, AActor* /*OldOwner*/, AActor* /*NewOwner*/);
+
 /**
- * Classe d'arme de base pour le multijoueur (hrite de AActor)
+ * Classe d'arme de base pour le multijoueur (hérite de AActor)
  */
 UCLASS()
 class AWeapon : public AActor
@@ -24,15 +32,114 @@ protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Weapon")
     USkeletalMeshComponent* WeaponMesh;
 
-    // Dgts de l'arme
-    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Replicated, Category = "Weapon")
+    // Dégâts de l'arme (copie répliquée de Stats.Damage)
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Replicated, Category = "Weapon")
     float Damage;
 
+    // Définition de l'arme (statistiques, mesh) ; si absente, Stats garde les valeurs par défaut
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon")
+    TObjectPtr<UWeaponDefinition> Definition;
+
+    // Copie locale des statistiques lue par le chemin de tir
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon")
+    FWeaponStats Stats;
+
+    // Mesh utilisé quand aucune définition n'en fournit, chargé de façon asynchrone comme celui de la définition
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon")
+    TSoftObjectPtr<USkeletalMesh> DefaultMesh;
+
+    // Socket du canon sur le mesh de l'arme
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon")
+    FName MuzzleSocketName = TEXT("Muzzle");
+
+    // Graine de dispersion tirée par le serveur à la création, répliquée une seule fois
+    UPROPERTY(Replicated)
+    int32 SpreadSeed = 0;
+
+    // Nombre de tirs effectués ; avec SpreadSeed il détermine entièrement la dispersion, le recul et le chargeur
+    int32 ShotCounter = 0;
+
+    // Serveur : instant de la dernière salve tirée (début du rechargement si elle a vidé le chargeur)
+    double LastFireTime = 0.0;
+
+    // Serveur : tirs autorisés, regagnés à la cadence de l'arme en temps serveur et plafonnés à une salve maximale
+    float FireCredit = 0.f;
+    double FireCreditTime = 0.0;
+
+    // Chargement asynchrone du mesh de la définition
+    TSharedPtr<FStreamableHandle> MeshLoadHandle;
+    void OnMeshLoaded();
+
+    // Mesh de la définition s'il existe, sinon DefaultMesh
+    const TSoftObjectPtr<USkeletalMesh>& GetMeshToLoad() const;
+
+    virtual void PostInitializeComponents() override;
+    virtual void BeginPlay() override;
+
+    // Serveur, à chaque ouverture de canal : compte l'état initial envoyé avec l'acteur
+    virtual void OnSerializeNewActor(class FOutBunch& OutBunch) override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    // Calcule l'origine et la direction du tir depuis le point de vue du porteur
+    void GetShotOriginAndDirection(FVector& OutStart, FVector& OutDirection) const;
+
 public:
-    // Fonction appele pour tirer
+    // Fonction appelée pour tirer (côté serveur : le tir est confié à UHitscanSubsystem ou UProjectileSubsystem)
     UFUNCTION(BlueprintCallable, Category = "Weapon")
     virtual void Fire();
 
-    // Rplication
+    // Tire NumShots coups d'un coup via le noyau spécialisé du mode de tir.
+    // FirstShotAge : temps écoulé depuis l'instant exact du premier tir (les suivants sont espacés de la cadence)
+    // RewindTime : instant serveur vu par un tireur distant, auquel les tirs hitscan rembobinent les personnages
+    void FireShots(int32 NumShots, float FirstShotAge = 0.f, double RewindTime = -1.0);
+
+    // Sortie du pool : l'arme redevient visible et appartient à NewOwner, avec un compteur de tirs remis à zéro
+    void ActivateForOwner(APawn* NewOwner);
+
+    // Rangement dans le pool : cachée et sans collision, mais toujours répliquée via son propriétaire
+    void Deactivate();
+
+    // Trace locale purement cosmétique d'un plomb prédit (retour visuel immédiat côté client)
+    bool PredictShot(int32 ShotIndex, int32 PelletIndex, FHitResult& OutHit) const;
+
+    // Diffusé côté serveur quand un tir de cette arme inflige des dégâts
+    FOnWeaponShotHit OnShotHit;
+
+    // Diffusé pour toute arme dont le porteur change
+    static FOnWeaponOwnerChanged OnOwnerChanged;
+
+    virtual void SetOwner(AActor* NewOwner) override;
+
+    // Demi-angle de dispersion actuel, réduit quand le porteur vise
+    float GetSpreadAngle() const;
+
+    // Direction déterministe d'un plomb : identique sur le client et le serveur pour un même compteur
+    FVector GetSpreadDirection(const FVector& AimDirection, float SpreadAngle, int32 ShotIndex, int32 PelletIndex) const;
+
+    // Recul déterministe du tir ShotIndex
+    FRotator GetRecoilKick(int32 ShotIndex) const;
+
+    int32 GetShotCounter() const { return ShotCounter; }
+
+    UFUNCTION(BlueprintPure, Category = "Weapon")
+    int32 GetRoundsInMagazine() const { return Stats.GetRoundsInMagazine(ShotCounter); }
+
+    // Serveur : vrai si une salve reçue du client tient dans un chargeur et ne devance pas le rechargement,
+    // y compris quand des tirs perdus en fin de chargeur la font commencer dans le suivant
+    bool CanFireClientShots(int32 FirstShotIndex, int32 NumShots) const;
+
+    // Serveur : prélève NumShots tirs sur le crédit de cadence ; faux (rien n'est prélevé) s'il est insuffisant.
+    // Les SkippedShots (tirs perdus avant la salve) sont prélevés dans la limite du crédit restant
+    bool ConsumeFireCredit(int32 NumShots, int64 SkippedShots);
+
+    // Le client avance son compteur prédit ; le serveur se recale sur le compteur reçu
+    void SetShotCounter(int32 NewCounter) { ShotCounter = NewCounter; }
+
+    const FWeaponStats& GetStats() const { return Stats; }
+    float GetDamage() const { return Damage; }
+    float GetRange() const { return Stats.Range; }
+    float GetHitImpulse() const { return Stats.HitImpulse; }
+
+    // Réplication
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 };
@@ -0,0 +1,8 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "WeaponDefinition.h"
+
+FPrimaryAssetId UWeaponDefinition::GetPrimaryAssetId() const
+{
+    return FPrimaryAssetId(TEXT("WeaponDefinition"), GetFName());
+}
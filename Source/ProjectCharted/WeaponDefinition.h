@@ -0,0 +1,149 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "WeaponDefinition.generated.h"
+
+class USkeletalMesh;
+
+/**
+ * Mode de tir : chaque mode a son propre noyau de tir spécialisé à la compilation
+ */
+UENUM(BlueprintType)
+enum class EWeaponFireMode : uint8
+{
+    // Une trace instantanée par tir
+    Hitscan,
+    // Plusieurs traces instantanées par tir (fusil à pompe)
+    Pellets,
+    // Projectile simulé par UProjectileSubsystem
+    Projectile
+};
+
+/**
+ * Statistiques d'une arme, copiées telles quelles dans l'arme pour le chemin de tir
+ */
+USTRUCT(BlueprintType)
+struct FWeaponStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fire")
+    EWeaponFireMode FireMode = EWeaponFireMode::Hitscan;
+
+    // Tir continu tant que la détente est maintenue
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fire")
+    bool bAutomatic = true;
+
+    // Cadence de tir
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fire", meta = (ClampMin = 1, Units = "RPM"))
+    float RoundsPerMinute = 600.f;
+
+    // Nombre de plombs par tir (mode Pellets)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fire", meta = (ClampMin = 1, ClampMax = 32, EditCondition = "FireMode == EWeaponFireMode::Pellets"))
+    uint8 PelletCount = 8;
+
+    // Demi-angle du cône de dispersion
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spread", meta = (ClampMin = 0, ClampMax = 45, Units = "deg"))
+    float SpreadAngle = 1.5f;
+
+    // Multiplicateur de dispersion en visée
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spread", meta = (ClampMin = 0, ClampMax = 1))
+    float AimSpreadMultiplier = 0.4f;
+
+    // Recul vertical appliqué à la visée à chaque tir
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Recoil", meta = (ClampMin = 0, ClampMax = 10, Units = "deg"))
+    float RecoilPitch = 0.4f;
+
+    // Recul horizontal maximal (gauche ou droite, tiré de la graine)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Recoil", meta = (ClampMin = 0, ClampMax = 10, Units = "deg"))
+    float RecoilYaw = 0.2f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Damage", meta = (ClampMin = 0))
+    float Damage = 20.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Damage", meta = (ClampMin = 0, Units = "cm/s"))
+    float HitImpulse = 150.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Damage", meta = (ClampMin = 0, Units = "cm"))
+    float Range = 10000.f;
+
+    // Distance à partir de laquelle les dégâts diminuent
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Damage|Falloff", meta = (ClampMin = 0, Units = "cm"))
+    float FalloffStart = 2000.f;
+
+    // Distance à partir de laquelle les dégâts sont minimaux
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Damage|Falloff", meta = (ClampMin = 0, Units = "cm"))
+    float FalloffEnd = 6000.f;
+
+    // Fraction des dégâts restante au-delà de FalloffEnd
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Damage|Falloff", meta = (ClampMin = 0, ClampMax = 1))
+    float MinDamageMultiplier = 0.5f;
+
+    // Nombre de surfaces que le tir peut traverser
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Damage|Penetration", meta = (ClampMin = 0, ClampMax = 4))
+    uint8 MaxPenetrations = 0;
+
+    // Fraction des dégâts conservée à chaque traversée
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Damage|Penetration", meta = (ClampMin = 0, ClampMax = 1))
+    float PenetrationDamageMultiplier = 0.6f;
+
+    // Tirs par chargeur ; le rechargement démarre automatiquement quand il est vide
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Magazine", meta = (ClampMin = 1))
+    int32 MagazineSize = 30;
+
+    // Délai entre le dernier tir d'un chargeur et le premier du suivant
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Magazine", meta = (ClampMin = 0, Units = "s"))
+    float ReloadTime = 2.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Projectile", meta = (ClampMin = 0, Units = "cm/s", EditCondition = "FireMode == EWeaponFireMode::Projectile"))
+    float ProjectileSpeed = 8000.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Projectile", meta = (EditCondition = "FireMode == EWeaponFireMode::Projectile"))
+    float ProjectileGravityScale = 1.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Projectile", meta = (ClampMin = 0, Units = "s", EditCondition = "FireMode == EWeaponFireMode::Projectile"))
+    float ProjectileLifetime = 3.f;
+
+    // Intervalle entre deux tirs
+    float GetFireInterval() const { return 60.f / FMath::Max(RoundsPerMinute, 1.f); }
+
+    // Cartouches restantes dans le chargeur après ShotCounter tirs (jamais 0 : un chargeur vide est rechargé)
+    int32 GetRoundsInMagazine(int32 ShotCounter) const
+    {
+        const int32 Size = FMath::Max(MagazineSize, 1);
+        return Size - ShotCounter % Size;
+    }
+
+    // Multiplicateur de dégâts selon la distance parcourue ; statique pour les tirs qui ne portent que ces trois réglages
+    static float GetFalloffMultiplier(float Distance, float Start, float End, float MinMultiplier)
+    {
+        return FMath::GetMappedRangeValueClamped(FVector2f(Start, FMath::Max(End, Start + 1.f)), FVector2f(1.f, MinMultiplier), Distance);
+    }
+};
+
+/**
+ * Définition d'arme pilotée par les données.
+ * Les références aux assets sont souples : rien n'est chargé de façon synchrone dans un constructeur.
+ */
+UCLASS(BlueprintType)
+class UWeaponDefinition : public UPrimaryDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon")
+    FWeaponStats Stats;
+
+    // Mesh de l'arme, chargé de façon asynchrone (bundle "Game" pour le préchargement par mode de jeu)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon", meta = (AssetBundles = "Game"))
+    TSoftObjectPtr<USkeletalMesh> Mesh;
+
+    // Socket du canon sur le mesh
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon")
+    FName MuzzleSocketName = TEXT("Muzzle");
+
+    virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+};
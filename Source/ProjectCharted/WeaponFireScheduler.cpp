@@ -0,0 +1,65 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "WeaponFireScheduler.h"
+
+void FWeaponFireScheduler::Press(double Now)
+{
+    bTriggerHeld = true;
+    bPendingSingleShot = true;
+
+    // Arme prête : le premier tir part à l'instant de l'appui, pas à la prochaine frame
+    if (NextShotTime < Now)
+    {
+        NextShotTime = Now;
+    }
+}
+
+void FWeaponFireScheduler::Release()
+{
+    // NextShotTime est conservé : relâcher ne réinitialise pas le temps de recharge entre deux tirs
+    bTriggerHeld = false;
+}
+
+void FWeaponFireScheduler::Delay(double ReadyTime)
+{
+    NextShotTime = FMath::Max(NextShotTime, ReadyTime);
+    bPendingSingleShot = false;
+}
+
+int32 FWeaponFireScheduler::Advance(double Now, double Interval, bool bAutomatic, double& OutFirstShotTime)
+{
+    if (NextShotTime > Now || Interval <= 0.0)
+    {
+        return 0;
+    }
+
+    // Semi-automatique, ou appui relâché avant le premier tir : un seul tir par appui
+    // (mis en attente si l'arme n'est pas encore prête)
+    if (!bAutomatic || !bTriggerHeld)
+    {
+        if (!bPendingSingleShot)
+        {
+            return 0;
+        }
+        bPendingSingleShot = false;
+        OutFirstShotTime = NextShotTime;
+        NextShotTime += Interval;
+        return 1;
+    }
+
+    // Tous les tirs dus depuis la dernière frame, à leurs instants exacts
+    int32 NumShots = int32((Now - NextShotTime) / Interval) + 1;
+    OutFirstShotTime = NextShotTime;
+    if (NumShots > MaxShotsPerAdvance)
+    {
+        // À-coup : on abandonne les tirs en trop plutôt que de rattraper
+        NumShots = MaxShotsPerAdvance;
+        NextShotTime = Now + Interval;
+    }
+    else
+    {
+        NextShotTime += NumShots * Interval;
+    }
+    bPendingSingleShot = false;
+    return NumShots;
+}
@@ -0,0 +1,36 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Planificateur de cadence de tir.
+ * Les instants de tir sont accumulés d'une frame à l'autre sans être arrondis à la frame :
+ * une arme à 900 coups/min tire 15 coups par seconde à 30 comme à 144 FPS, et tous les tirs
+ * dus pendant une frame sont rendus en un seul lot avec leur instant exact.
+ */
+struct FWeaponFireScheduler
+{
+    // Limite de tirs rendus en une frame (protège contre les gros à-coups)
+    static constexpr int32 MaxShotsPerAdvance = 8;
+
+    // Détente pressée à l'instant Now
+    void Press(double Now);
+
+    // Détente relâchée
+    void Release();
+
+    // Renvoie le nombre de tirs dus jusqu'à Now ; OutFirstShotTime reçoit l'instant exact du premier
+    int32 Advance(double Now, double Interval, bool bAutomatic, double& OutFirstShotTime);
+
+    // Aucun tir avant ReadyTime (rechargement) ; un appui en attente est abandonné
+    void Delay(double ReadyTime);
+
+    bool IsTriggerHeld() const { return bTriggerHeld; }
+
+private:
+    double NextShotTime = 0.0;
+    bool bTriggerHeld = false;
+    bool bPendingSingleShot = false;
+};
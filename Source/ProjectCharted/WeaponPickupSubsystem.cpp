@@ -0,0 +1,83 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "WeaponPickupSubsystem.h"
+#include "Weapon.h"
+#include "Engine/World.h"
+
+bool UWeaponPickupSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+FIntPoint UWeaponPickupSubsystem::GetCell(const FVector& Location)
+{
+    return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void UWeaponPickupSubsystem::RegisterPickup(AWeapon* Weapon)
+{
+    if (!IsValid(Weapon)) return;
+
+    // Une arme déplacée est réindexée à sa nouvelle position
+    UnregisterPickup(Weapon);
+
+    const FVector Location = Weapon->GetActorLocation();
+    const FIntPoint Cell = GetCell(Location);
+    Cells.FindOrAdd(Cell).Add({ Weapon, Location });
+    WeaponCells.Add(Weapon, Cell);
+}
+
+void UWeaponPickupSubsystem::UnregisterPickup(AWeapon* Weapon)
+{
+    FIntPoint Cell;
+    if (!WeaponCells.RemoveAndCopyValue(Weapon, Cell)) return;
+
+    if (TArray<FPickupEntry>* Entries = Cells.Find(Cell))
+    {
+        Entries->RemoveAllSwap([Weapon](const FPickupEntry& Entry) { return Entry.Weapon == Weapon; });
+        if (Entries->IsEmpty())
+        {
+            Cells.Remove(Cell);
+        }
+    }
+}
+
+AWeapon* UWeaponPickupSubsystem::FindNearestPickup(const FVector& Location, float Reach) const
+{
+    ensureMsgf(Reach <= CellSize, TEXT("Pickup reach %.0f exceeds the grid cell size %.0f"), Reach, CellSize);
+
+    const FIntPoint Center = GetCell(Location);
+    AWeapon* Nearest = nullptr;
+    double NearestDistSq = FMath::Square(double(Reach));
+
+    for (int32 Y = Center.Y - 1; Y <= Center.Y + 1; ++Y)
+    {
+        for (int32 X = Center.X - 1; X <= Center.X + 1; ++X)
+        {
+            const TArray<FPickupEntry>* Entries = Cells.Find(FIntPoint(X, Y));
+            if (!Entries) continue;
+
+            for (const FPickupEntry& Entry : *Entries)
+            {
+                const double DistSq = FVector::DistSquared(Entry.Location, Location);
+                if (DistSq <= NearestDistSq && Entry.Weapon.IsValid())
+                {
+                    NearestDistSq = DistSq;
+                    Nearest = Entry.Weapon.Get();
+                }
+            }
+        }
+    }
+    return Nearest;
+}
+
+bool UWeaponPickupSubsystem::IsPickupInReach(const AWeapon* Weapon, const FVector& Location, float Reach) const
+{
+    // Seules les armes indexées sont ramassables : une arme tenue ou rangée dans le pool est refusée
+    const FIntPoint* Cell = WeaponCells.Find(const_cast<AWeapon*>(Weapon));
+    if (!Cell) return false;
+
+    const TArray<FPickupEntry>* Entries = Cells.Find(*Cell);
+    const FPickupEntry* Entry = Entries ? Entries->FindByPredicate([Weapon](const FPickupEntry& Candidate) { return Candidate.Weapon == Weapon; }) : nullptr;
+    return Entry && FVector::DistSquared(Entry->Location, Location) <= FMath::Square(double(Reach));
+}
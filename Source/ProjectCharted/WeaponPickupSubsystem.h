@@ -0,0 +1,55 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WeaponPickupSubsystem.generated.h"
+
+class AWeapon;
+
+/**
+ * Index spatial serveur des armes posées au sol.
+ * Grille uniforme dont les cellules sont au moins aussi grandes que la portée de ramassage :
+ * la recherche de l'arme la plus proche ne parcourt que les 3x3 cellules autour du joueur,
+ * quel que soit le nombre d'armes dans le niveau, et remplace les requêtes d'overlap par capsule.
+ */
+UCLASS()
+class UWeaponPickupSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Taille d'une cellule ; toute portée de ramassage doit lui être inférieure ou égale
+    static constexpr float CellSize = 500.f;
+
+    // Rend l'arme ramassable à sa position actuelle (serveur uniquement)
+    void RegisterPickup(AWeapon* Weapon);
+
+    // Retire l'arme de l'index (ramassée, rangée dans le pool ou détruite)
+    void UnregisterPickup(AWeapon* Weapon);
+
+    // Arme ramassable la plus proche de Location dans le rayon Reach, ou nullptr
+    AWeapon* FindNearestPickup(const FVector& Location, float Reach) const;
+
+    // Vrai si l'arme est indexée et à moins de Reach de Location
+    bool IsPickupInReach(const AWeapon* Weapon, const FVector& Location, float Reach) const;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    struct FPickupEntry
+    {
+        TWeakObjectPtr<AWeapon> Weapon;
+        FVector Location;
+    };
+
+    static FIntPoint GetCell(const FVector& Location);
+
+    // Armes par cellule (plan XY)
+    TMap<FIntPoint, TArray<FPickupEntry>> Cells;
+
+    // Cellule de chaque arme indexée, pour le retrait et la validation sans parcours de la grille
+    TMap<TWeakObjectPtr<AWeapon>, FIntPoint> WeaponCells;
+};
@@ -0,0 +1,65 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "WeaponPoolSubsystem.h"
+#include "Weapon.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+
+bool UWeaponPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+AWeapon* UWeaponPoolSubsystem::AcquireWeapon(TSubclassOf<AWeapon> WeaponClass, APawn* NewOwner)
+{
+    if (!WeaponClass) return nullptr;
+
+    if (FWeaponPoolList* List = FreeWeapons.Find(WeaponClass.Get()))
+    {
+        // Nettoyer les armes détruites entre-temps
+        List->Weapons.RemoveAllSwap([](const AWeapon* Weapon) { return !IsValid(Weapon); });
+
+        // Priorité à une arme déjà possédée : aucun changement de propriétaire à répliquer
+        int32 Index = List->Weapons.IndexOfByPredicate([NewOwner](const AWeapon* Weapon) { return Weapon->GetOwner() == NewOwner; });
+        if (Index == INDEX_NONE && List->Weapons.Num() > 0)
+        {
+            Index = List->Weapons.Num() - 1;
+        }
+
+        if (Index != INDEX_NONE)
+        {
+            AWeapon* Weapon = List->Weapons[Index];
+            List->Weapons.RemoveAtSwap(Index);
+            Weapon->ActivateForOwner(NewOwner);
+            return Weapon;
+        }
+    }
+
+    // Pool vide : on crée une nouvelle instance
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.Owner = NewOwner;
+    SpawnParams.Instigator = NewOwner;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    AWeapon* Weapon = GetWorld()->SpawnActor<AWeapon>(WeaponClass, FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+    if (Weapon)
+    {
+        Weapon->ActivateForOwner(NewOwner);
+    }
+    return Weapon;
+}
+
+void UWeaponPoolSubsystem::ReleaseWeapon(AWeapon* Weapon)
+{
+    if (!IsValid(Weapon)) return;
+
+    Weapon->Deactivate();
+    FreeWeapons.FindOrAdd(Weapon->GetClass()).Weapons.AddUnique(Weapon);
+}
+
+void UWeaponPoolSubsystem::RemoveFromPool(AWeapon* Weapon)
+{
+    if (FWeaponPoolList* List = FreeWeapons.Find(Weapon ? Weapon->GetClass() : nullptr))
+    {
+        List->Weapons.RemoveSwap(Weapon);
+    }
+}
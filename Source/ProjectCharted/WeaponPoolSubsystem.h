@@ -0,0 +1,49 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WeaponPoolSubsystem.generated.h"
+
+class AWeapon;
+
+/**
+ * Armes libres d'une même classe
+ */
+USTRUCT()
+struct FWeaponPoolList
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<TObjectPtr<AWeapon>> Weapons;
+};
+
+/**
+ * Pool d'armes côté serveur. Les armes rangées restent des acteurs vivants (cachés, sans collision)
+ * au lieu d'être détruites : changer d'arme ne fait que modifier des propriétés répliquées,
+ * sans ouvrir ni fermer de canal d'acteur.
+ */
+UCLASS()
+class UWeaponPoolSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Récupère une arme libre de cette classe (de préférence déjà possédée par NewOwner), sinon en crée une
+    AWeapon* AcquireWeapon(TSubclassOf<AWeapon> WeaponClass, APawn* NewOwner);
+
+    // Range une arme dans le pool ; elle reste attribuée à son dernier porteur jusqu'à sa réutilisation
+    void ReleaseWeapon(AWeapon* Weapon);
+
+    // Retire une arme du pool sans la réactiver (ex. arme ramassée au sol)
+    void RemoveFromPool(AWeapon* Weapon);
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    UPROPERTY()
+    TMap<TObjectPtr<UClass>, FWeaponPoolList> FreeWeapons;
+};
@@ -0,0 +1,61 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "ProjectChartedBudgetSettings.generated.h"
+
+/**
+ * Budgets de performance d'une carte de variante ; 0 = non vérifié
+ */
+USTRUCT()
+struct FVariantBudget
+{
+    GENERATED_BODY()
+
+    // Carte chargée par le test, par exemple /Game/Variant_Combat/Lvl_Combat
+    UPROPERTY()
+    FString Map;
+
+    UPROPERTY()
+    float MaxAvgGameThreadMs = 0.f;
+
+    UPROPERTY()
+    float MaxP99GameThreadMs = 0.f;
+
+    // Acteurs apparus pendant les frames mesurées
+    UPROPERTY()
+    int32 MaxSpawnedActors = 0;
+
+    // Pic de mémoire physique utilisée
+    UPROPERTY()
+    float MaxMemoryMB = 0.f;
+};
+
+/**
+ * Réglages des tests de budget par variante (section [/Script/ProjectChartedTests.ProjectChartedBudgetSettings]
+ * de DefaultGame.ini) : un test est généré pour chaque entrée de VariantBudgets.
+ */
+UCLASS(config = Game, defaultconfig)
+class UProjectChartedBudgetSettings : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    // Frames jouées avant la mesure (chargement des assets, apparition des acteurs)
+    UPROPERTY(Config)
+    int32 WarmUpFrames = 120;
+
+    // Frames mesurées, chacune avec l'entrée scriptée
+    UPROPERTY(Config)
+    int32 MeasuredFrames = 600;
+
+    UPROPERTY(Config)
+    TArray<FVariantBudget> VariantBudgets;
+
+    const FVariantBudget* FindBudget(const FString& Map) const
+    {
+        return VariantBudgets.FindByPredicate([&Map](const FVariantBudget& Budget) { return Budget.Map == Map; });
+    }
+};
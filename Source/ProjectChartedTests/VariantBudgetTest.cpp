@@ -0,0 +1,237 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ProjectChartedBudgetSettings.h"
+#include "SampleStats.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/App.h"
+#include "Misc/PackageName.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace VariantBudget
+{
+    // Bouton pressé toutes les Period frames et relâché HoldFrames plus tard.
+    // Appelé par réflexion : seules les variantes qui ont la fonction la reçoivent
+    struct FScriptedPress
+    {
+        const TCHAR* Start;
+        const TCHAR* End;
+        int32 Period;
+        int32 HoldFrames;
+    };
+
+    const FScriptedPress ScriptedPresses[] =
+    {
+        { TEXT("DoFireStart"), TEXT("DoFireEnd"), 120, 60 },
+        { TEXT("DoAimStart"), TEXT("DoAimEnd"), 300, 150 },
+        { TEXT("DoComboAttackStart"), TEXT("DoComboAttackEnd"), 75, 5 },
+        { TEXT("DoDash"), nullptr, 200, 0 },
+    };
+
+    // Saut : commun à tous les personnages via ACharacter
+    constexpr int32 JumpPeriod = 90;
+    constexpr int32 JumpHoldFrames = 10;
+
+    // Monde de jeu (-game) ou de PIE (éditeur)
+    UWorld* FindGameWorld()
+    {
+        for (const FWorldContext& Context : GEngine->GetWorldContexts())
+        {
+            if ((Context.WorldType == EWorldType::Game || Context.WorldType == EWorldType::PIE) && Context.World())
+            {
+                return Context.World();
+            }
+        }
+        return nullptr;
+    }
+
+    void CheckBudget(FAutomationTestBase* Test, const TCHAR* Budget, float Value, float Limit)
+    {
+        if (Limit > 0.f)
+        {
+            Test->TestTrue(FString::Printf(TEXT("%s = %.3f (budget %.3f)"), Budget, Value, Limit), Value <= Limit);
+        }
+    }
+}
+
+/**
+ * Joue l'entrée scriptée sur le pawn du joueur local à chaque frame, mesure les frames après le préchauffage
+ * puis vérifie les budgets de la carte
+ */
+class FRunVariantBudgetCommand : public IAutomationLatentCommand
+{
+public:
+    FRunVariantBudgetCommand(FAutomationTestBase* InTest, const FVariantBudget& InBudget, int32 InWarmUpFrames, int32 InMeasuredFrames)
+        : Test(InTest)
+        , Budget(InBudget)
+        , WarmUpFrames(FMath::Max(InWarmUpFrames, 0))
+        , MeasuredFrames(FMath::Max(InMeasuredFrames, 1))
+    {
+        GameThreadMs.Reserve(MeasuredFrames);
+    }
+
+    virtual ~FRunVariantBudgetCommand() override
+    {
+        StopCountingSpawns();
+    }
+
+    virtual bool Update() override
+    {
+        UWorld* World = GameWorld.Get();
+        if (!World)
+        {
+            World = VariantBudget::FindGameWorld();
+            if (!World)
+            {
+                Test->AddError(FString::Printf(TEXT("%s: no game world after loading the map"), *Budget.Map));
+                return true;
+            }
+            GameWorld = World;
+        }
+
+        ApplyScriptedInput(World);
+        ++Frame;
+
+        if (Frame <= WarmUpFrames)
+        {
+            if (Frame == WarmUpFrames)
+            {
+                SpawnHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateLambda([this](AActor*) { ++SpawnedActors; }));
+            }
+            return false;
+        }
+
+        // Temps de travail de la frame : le sommeil de limitation de fréquence est retiré, comme dans le mode soak
+        const double FrameSeconds = FApp::GetDeltaTime();
+        GameThreadMs.Add(float(FMath::Max(FrameSeconds - FApp::GetIdleTime(), 0.0) * 1000.0));
+        PeakMemoryMB = FMath::Max(PeakMemoryMB, float(FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0)));
+
+        if (Frame < WarmUpFrames + MeasuredFrames)
+        {
+            return false;
+        }
+
+        StopCountingSpawns();
+        CheckBudgets();
+        return true;
+    }
+
+private:
+    void ApplyScriptedInput(UWorld* World) const
+    {
+        APlayerController* PlayerController = World->GetFirstPlayerController();
+        APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+        if (!Pawn) return;
+
+        // Cercle complet en 8 s à 60 FPS, caméra en rotation continue
+        Pawn->AddMovementInput(FRotator(0.f, Frame * 0.75f, 0.f).Vector());
+        PlayerController->AddYawInput(0.5f);
+
+        if (ACharacter* Character = Cast<ACharacter>(Pawn))
+        {
+            const int32 JumpPhase = Frame % VariantBudget::JumpPeriod;
+            if (JumpPhase == 0)
+            {
+                Character->Jump();
+            }
+            else if (JumpPhase == VariantBudget::JumpHoldFrames)
+            {
+                Character->StopJumping();
+            }
+        }
+
+        for (const VariantBudget::FScriptedPress& Press : VariantBudget::ScriptedPresses)
+        {
+            const int32 Phase = Frame % Press.Period;
+            const TCHAR* FunctionName = Phase == 0 ? Press.Start : (Phase == Press.HoldFrames ? Press.End : nullptr);
+            if (!FunctionName) continue;
+
+            UFunction* Function = Pawn->FindFunction(FName(FunctionName));
+            if (Function && Function->NumParms == 0)
+            {
+                Pawn->ProcessEvent(Function, nullptr);
+            }
+        }
+    }
+
+    void StopCountingSpawns()
+    {
+        if (UWorld* World = GameWorld.Get(); World && SpawnHandle.IsValid())
+        {
+            World->RemoveOnActorSpawnedHandler(SpawnHandle);
+        }
+        SpawnHandle.Reset();
+    }
+
+    void CheckBudgets()
+    {
+        TArray<float> Sorted = GameThreadMs;
+        Sorted.Sort();
+        const float AvgMs = SampleStats::Mean(Sorted);
+        const float P99Ms = SampleStats::Percentile(Sorted, 0.99f);
+
+        Test->AddInfo(FString::Printf(TEXT("%s: %d frames, avg %.3f ms, p99 %.3f ms, %d spawned actors, peak %.0f MB"),
+            *Budget.Map, Sorted.Num(), AvgMs, P99Ms, SpawnedActors, PeakMemoryMB));
+
+        VariantBudget::CheckBudget(Test, TEXT("AvgGameThreadMs"), AvgMs, Budget.MaxAvgGameThreadMs);
+        VariantBudget::CheckBudget(Test, TEXT("P99GameThreadMs"), P99Ms, Budget.MaxP99GameThreadMs);
+        VariantBudget::CheckBudget(Test, TEXT("SpawnedActors"), float(SpawnedActors), float(Budget.MaxSpawnedActors));
+        VariantBudget::CheckBudget(Test, TEXT("MemoryMB"), PeakMemoryMB, Budget.MaxMemoryMB);
+    }
+
+    FAutomationTestBase* Test;
+    FVariantBudget Budget;
+    int32 WarmUpFrames;
+    int32 MeasuredFrames;
+
+    TWeakObjectPtr<UWorld> GameWorld;
+    int32 Frame = 0;
+    TArray<float> GameThreadMs;
+    float PeakMemoryMB = 0.f;
+    int32 SpawnedActors = 0;
+    FDelegateHandle SpawnHandle;
+};
+
+/**
+ * Un test par carte de variante listée dans UProjectChartedBudgetSettings, par exemple sans GPU :
+ *   UnrealEditor-Cmd ProjectCharted.uproject -game -nullrhi -unattended -ExecCmds="Automation RunTests ProjectCharted.Performance;Quit"
+ */
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FProjectChartedVariantBudgetTest, "ProjectCharted.Performance.VariantBudget",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+void FProjectChartedVariantBudgetTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+    for (const FVariantBudget& Budget : GetDefault<UProjectChartedBudgetSettings>()->VariantBudgets)
+    {
+        OutBeautifiedNames.Add(FPackageName::GetShortName(Budget.Map));
+        OutTestCommands.Add(Budget.Map);
+    }
+}
+
+bool FProjectChartedVariantBudgetTest::RunTest(const FString& Parameters)
+{
+    const UProjectChartedBudgetSettings* Settings = GetDefault<UProjectChartedBudgetSettings>();
+    const FVariantBudget* Budget = Settings->FindBudget(Parameters);
+    if (!Budget)
+    {
+        AddError(FString::Printf(TEXT("No budget configured for %s"), *Parameters));
+        return false;
+    }
+
+    if (!AutomationOpenMap(Budget->Map))
+    {
+        AddError(FString::Printf(TEXT("Could not open %s"), *Budget->Map));
+        return false;
+    }
+
+    ADD_LATENT_AUTOMATION_COMMAND(FRunVariantBudgetCommand(this, *Budget, Settings->WarmUpFrames, Settings->MeasuredFrames));
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS